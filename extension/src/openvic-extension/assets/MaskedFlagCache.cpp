@@ -0,0 +1,72 @@
+#include "MaskedFlagCache.hpp"
+
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+#include <openvic-simulation/country/CountryDefinition.hpp>
+
+#include "openvic-extension/classes/GFXMaskedFlagTexture.hpp"
+#include "openvic-extension/core/Convert.hpp"
+#include "openvic-extension/utility/Utilities.hpp"
+
+using namespace godot;
+using namespace OpenVic;
+
+uint32_t MaskedFlagCache::key_t::hash(key_t const& key) {
+	uint32_t hash = hash_murmur3_one_32(key.overlay_file.hash());
+	hash = hash_murmur3_one_32(key.mask_file.hash(), hash);
+	hash = hash_murmur3_one_64(reinterpret_cast<uintptr_t>(key.country), hash);
+	hash = hash_murmur3_one_32(key.flag_type.hash(), hash);
+	return hash_fmix32(hash);
+}
+
+StringName MaskedFlagCache::key_t::make_button_state_source_key() const {
+	/* Country identifiers are used rather than pointers, which may be reused by a later session's countries. */
+	return StringName { Utilities::format(
+		"masked_flag:%s:%s:%s:%s", overlay_file, mask_file,
+		country != nullptr ? convert_to<String>(country->get_identifier()) : String {}, flag_type
+	) };
+}
+
+RefCounted const* MaskedFlagCache::masked_flag_t::get_cache_reference() const {
+	return texture.ptr();
+}
+
+MaskedFlagCache::masked_flag_t MaskedFlagCache::get_masked_flag(key_t const& key) const {
+	masked_flag_t const* masked_flag = masked_flags.find(key);
+	return masked_flag != nullptr ? *masked_flag : masked_flag_t {};
+}
+
+void MaskedFlagCache::add_masked_flag(key_t const& key, masked_flag_t const& masked_flag) {
+	ERR_FAIL_NULL(masked_flag.image);
+	ERR_FAIL_NULL(masked_flag.texture);
+	ERR_FAIL_COND(masked_flag.button_state_source_key.is_empty());
+
+	masked_flags.insert(key, masked_flag);
+}
+
+size_t MaskedFlagCache::size() const {
+	return masked_flags.size();
+}
+
+Ref<Shader> MaskedFlagCache::get_shader() {
+	if (shader.is_null()) {
+		shader.instantiate();
+		ERR_FAIL_NULL_V(shader, nullptr);
+		shader->set_code(GFXMaskedFlagTexture::get_shader_code());
+	}
+	return shader;
+}
+
+Ref<ShaderMaterial> MaskedFlagCache::get_shader_material(GFX::MaskedFlag const* gfx_masked_flag) const {
+	const shader_material_map_t::ConstIterator it = shader_materials.find(gfx_masked_flag);
+	return it != shader_materials.end() ? it->value : nullptr;
+}
+
+void MaskedFlagCache::add_shader_material(
+	GFX::MaskedFlag const* gfx_masked_flag, Ref<ShaderMaterial> const& shader_material
+) {
+	ERR_FAIL_NULL(gfx_masked_flag);
+	ERR_FAIL_NULL(shader_material);
+
+	shader_materials.insert(gfx_masked_flag, shader_material);
+}
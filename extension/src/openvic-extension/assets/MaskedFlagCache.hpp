@@ -0,0 +1,76 @@
+#pragma once
+
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <openvic-simulation/interface/GFXSprite.hpp>
+
+#include "openvic-extension/utility/RefCountedCache.hpp"
+
+namespace OpenVic {
+	struct CountryDefinition;
+
+	/* Combined masked flag images are shared between every GFXMaskedFlagTexture showing the same country's flag with the
+	 * same overlay and mask. These are identified by file rather than GFX::MaskedFlag, as different masked flag sprites may
+	 * use the same images. Shader mode GFXMaskedFlagTextures instead share one material per GFX::MaskedFlag, which are
+	 * never pruned as there are only as many as there are masked flag sprites. */
+	class MaskedFlagCache {
+	public:
+		struct key_t {
+			godot::StringName overlay_file;
+			godot::StringName mask_file;
+			/* nullptr for the overlay on its own, with no flag. */
+			CountryDefinition const* country;
+			godot::StringName flag_type;
+
+			bool operator==(key_t const& other) const = default;
+
+			static uint32_t hash(key_t const& key);
+
+			/* A string uniquely describing the combined image, for use as its button state variants' source key. It
+			 * depends only on the key, so variants are still shared after the image is pruned and regenerated. */
+			godot::StringName make_button_state_source_key() const;
+		};
+
+		/* Neither the image nor the texture may be modified once added to the cache. */
+		struct masked_flag_t {
+			godot::Ref<godot::Image> image;
+			godot::Ref<godot::ImageTexture> texture;
+			godot::StringName button_state_source_key;
+
+			/* Entries are kept for as long as anything else references their texture. */
+			godot::RefCounted const* get_cache_reference() const;
+		};
+
+	private:
+		RefCountedCache<key_t, masked_flag_t, 256> masked_flags;
+		godot::Ref<godot::Shader> shader;
+		using shader_material_map_t = godot::HashMap<GFX::MaskedFlag const*, godot::Ref<godot::ShaderMaterial>>;
+		shader_material_map_t shader_materials;
+
+	public:
+		/* Return the previously generated combined image and texture for the given masked flag, or nulls if there are
+		 * none. */
+		masked_flag_t get_masked_flag(key_t const& key) const;
+
+		/* Add a newly generated combined image and texture to the cache for sharing. */
+		void add_masked_flag(key_t const& key, masked_flag_t const& masked_flag);
+
+		size_t size() const;
+
+		/* Shader used by every shader mode GFXMaskedFlagTexture, created on first use. */
+		godot::Ref<godot::Shader> get_shader();
+
+		/* Return the material shared by every shader mode GFXMaskedFlagTexture using the given masked flag sprite, or
+		 * nullptr if there isn't one yet. */
+		godot::Ref<godot::ShaderMaterial> get_shader_material(GFX::MaskedFlag const* gfx_masked_flag) const;
+
+		void add_shader_material(
+			GFX::MaskedFlag const* gfx_masked_flag, godot::Ref<godot::ShaderMaterial> const& shader_material
+		);
+	};
+}
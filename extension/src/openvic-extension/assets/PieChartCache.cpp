@@ -0,0 +1,46 @@
+#include "PieChartCache.hpp"
+
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+#include "openvic-extension/classes/GFXPieChartTexture.hpp"
+
+using namespace godot;
+using namespace OpenVic;
+
+uint32_t PieChartCache::key_t::hash(key_t const& key) {
+	uint32_t hash = hash_murmur3_one_32(key.radius);
+	for (const uint32_t value : key.slice_signature) {
+		hash = hash_murmur3_one_32(value, hash);
+	}
+	return hash_fmix32(hash);
+}
+
+Ref<ImageTexture> PieChartCache::get_pie_chart_texture(key_t const& key) const {
+	Ref<ImageTexture> const* texture = pie_chart_textures.find(key);
+	return texture != nullptr ? *texture : nullptr;
+}
+
+void PieChartCache::add_pie_chart_texture(key_t const& key, Ref<ImageTexture> const& texture) {
+	ERR_FAIL_NULL(texture);
+
+	pie_chart_textures.insert(key, texture);
+}
+
+size_t PieChartCache::size() const {
+	return pie_chart_textures.size();
+}
+
+Ref<ShaderMaterial> PieChartCache::get_shader_material() {
+	if (shader_material.is_null()) {
+		Ref<Shader> shader;
+		shader.instantiate();
+		ERR_FAIL_NULL_V(shader, nullptr);
+		shader->set_code(GFXPieChartTexture::get_shader_code());
+
+		shader_material.instantiate();
+		ERR_FAIL_NULL_V(shader_material, nullptr);
+		shader_material->set_shader(shader);
+	}
+	return shader_material;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+
+#include <openvic-simulation/core/memory/Vector.hpp>
+
+#include "openvic-extension/utility/RefCountedCache.hpp"
+
+namespace OpenVic {
+	/* Pie chart textures are shared between every GFXPieChartTexture of the same radius showing the same slices, which is
+	 * common for rows of homogeneous pops, so each distinct pie chart is only uploaded to the GPU once. Shader mode
+	 * GFXPieChartTextures instead all share a single material. */
+	class PieChartCache {
+	public:
+		struct key_t {
+			int32_t radius = 0;
+			/* Each slice's RGBA8 colour followed by the angle at which it ends, quantised to ANGLE_STEPS of a full
+			 * rotation. */
+			memory::vector<uint32_t> slice_signature;
+
+			bool operator==(key_t const& other) const = default;
+
+			static uint32_t hash(key_t const& key);
+		};
+		/* Fine enough that quantisation never moves a slice boundary by a visible amount at GUI pie chart sizes. */
+		static constexpr uint32_t ANGLE_STEPS = 1 << 12;
+
+	private:
+		RefCountedCache<key_t, godot::Ref<godot::ImageTexture>, 256> pie_chart_textures;
+		godot::Ref<godot::ShaderMaterial> shader_material;
+
+	public:
+		/* Return the previously drawn texture for the given pie chart, or nullptr if there isn't one. */
+		godot::Ref<godot::ImageTexture> get_pie_chart_texture(key_t const& key) const;
+
+		/* Add a newly drawn pie chart texture to the cache for sharing. The texture must not be modified afterwards, and
+		 * is kept for as long as anything else references it. */
+		void add_pie_chart_texture(key_t const& key, godot::Ref<godot::ImageTexture> const& texture);
+
+		size_t size() const;
+
+		/* Material used by every shader mode GFXPieChartTexture, created on first use. */
+		godot::Ref<godot::ShaderMaterial> get_shader_material();
+	};
+}
@@ -0,0 +1,37 @@
+#include "ShapedTextCache.hpp"
+
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+using namespace godot;
+using namespace OpenVic;
+
+uint32_t ShapedTextCache::key_t::hash(key_t const& key) {
+	uint32_t hash = hash_murmur3_one_64(key.font_id);
+	hash = hash_murmur3_one_32(key.font_size, hash);
+	hash = hash_murmur3_one_32(key.string.hash(), hash);
+	return hash_fmix32(hash);
+}
+
+Ref<TextLine> ShapedTextCache::get_shaped_text(Ref<Font> const& font, int32_t font_size, String const& string) {
+	ERR_FAIL_NULL_V(font, nullptr);
+
+	const key_t key { font->get_instance_id(), font_size, string };
+
+	Ref<TextLine> const* cached_shaped_text = shaped_texts.find(key);
+	if (cached_shaped_text != nullptr) {
+		return *cached_shaped_text;
+	}
+
+	Ref<TextLine> shaped_text;
+	shaped_text.instantiate();
+	ERR_FAIL_NULL_V(shaped_text, nullptr);
+	ERR_FAIL_COND_V(!shaped_text->add_string(string, font, font_size), nullptr);
+
+	shaped_texts.insert(key, shaped_text);
+
+	return shaped_text;
+}
+
+size_t ShapedTextCache::size() const {
+	return shaped_texts.size();
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <godot_cpp/classes/font.hpp>
+#include <godot_cpp/classes/text_line.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include "openvic-extension/utility/RefCountedCache.hpp"
+
+namespace OpenVic {
+	/* Shaped text is shared between every GUILabel segment drawing the same string with the same font and size, so labels
+	 * whose text changes back and forth (or only in part) don't need to reshape it each time. */
+	class ShapedTextCache {
+	public:
+		struct key_t {
+			uint64_t font_id = 0;
+			int32_t font_size = 0;
+			godot::String string;
+
+			bool operator==(key_t const& other) const = default;
+
+			static uint32_t hash(key_t const& key);
+		};
+
+	private:
+		RefCountedCache<key_t, godot::Ref<godot::TextLine>, 1024> shaped_texts;
+
+	public:
+		/* Return the given string shaped with the given font and size, shaping and caching it if this hasn't already been
+		 * done. The result must not be modified, and is kept for as long as anything else references it. */
+		godot::Ref<godot::TextLine> get_shaped_text(
+			godot::Ref<godot::Font> const& font, int32_t font_size, godot::String const& string
+		);
+
+		size_t size() const;
+	};
+}
@@ -1,9 +1,13 @@
 #include "GFXButtonStateTexture.hpp"
 
+#include <algorithm>
+
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 #include "openvic-extension/core/Bind.hpp"
+#include "openvic-extension/singletons/AssetManager.hpp"
+#include "openvic-extension/utility/Utilities.hpp"
 
 using namespace OpenVic;
 using namespace godot;
@@ -24,9 +28,10 @@ void GFXCorneredTileSupportingTexture::draw_rect_cornered(RID const& to_canvas_i
 	if (is_cornered_tile_texture()) {
 		RenderingServer* rendering_server = RenderingServer::get_singleton();
 		if (rendering_server != nullptr) {
+			/* The source rect is in atlas coordinates, as get_rid() returns the atlas texture's RID. */
 			const Size2 size = get_size();
 			rendering_server->canvas_item_add_nine_patch(
-				to_canvas_item, rect, { {}, size }, get_rid(),
+				to_canvas_item, rect, { get_region().position, size }, get_rid(),
 				cornered_tile_border_size, size - cornered_tile_border_size
 			);
 		}
@@ -42,7 +47,11 @@ void GFXButtonStateTexture::_bind_methods() {
 	OV_BIND_SMETHOD(button_state_to_name, { "button_state" });
 	OV_BIND_METHOD(GFXButtonStateTexture::get_button_state_name);
 
-	OV_BIND_METHOD(GFXButtonStateTexture::generate_state_image, { "source_image", "region", "new_cornered_tile_border_size" });
+	OV_BIND_SMETHOD(make_state_image, { "button_state", "source_image", "region" });
+	OV_BIND_METHOD(
+		GFXButtonStateTexture::generate_state_image,
+		{ "source_image", "region", "new_cornered_tile_border_size", "shared_source_key" }, DEFVAL(StringName {})
+	);
 
 	BIND_ENUM_CONSTANT(HOVER);
 	BIND_ENUM_CONSTANT(PRESSED);
@@ -53,7 +62,8 @@ void GFXButtonStateTexture::_bind_methods() {
 GFXButtonStateTexture::GFXButtonStateTexture() {}
 
 Ref<GFXButtonStateTexture> GFXButtonStateTexture::make_gfx_button_state_texture(
-	ButtonState button_state, Ref<Image> const& source_image, Rect2i const& region, Vector2i const& cornered_tile_border_size
+	ButtonState button_state, Ref<Image> const& source_image, Rect2i const& region, Vector2i const& cornered_tile_border_size,
+	StringName const& shared_source_key
 ) {
 	Ref<GFXButtonStateTexture> button_state_texture;
 	button_state_texture.instantiate();
@@ -61,7 +71,9 @@ Ref<GFXButtonStateTexture> GFXButtonStateTexture::make_gfx_button_state_texture(
 	button_state_texture->set_button_state(button_state);
 	if (source_image.is_valid()) {
 		ERR_FAIL_COND_V(
-			button_state_texture->generate_state_image(source_image, region, cornered_tile_border_size) != OK, nullptr
+			button_state_texture->generate_state_image(
+				source_image, region, cornered_tile_border_size, shared_source_key
+			) != OK, nullptr
 		);
 	}
 	return button_state_texture;
@@ -75,62 +87,122 @@ void GFXButtonStateTexture::set_button_state(ButtonState new_button_state) {
 	button_state = new_button_state;
 }
 
-Error GFXButtonStateTexture::generate_state_image(
-	Ref<Image> const& source_image, Rect2i const& region, Vector2i const& new_cornered_tile_border_size
+/* Colour adjustments are applied to raw RGBA8 data using integer arithmetic, with 26 and 77 being the closest
+ * 8-bit equivalents of 0.1 and 0.3 of full channel intensity. */
+static constexpr int32_t HOVER_OFFSET = 26;
+static constexpr int32_t PRESSED_OFFSET = -26;
+static constexpr int32_t SELECTED_OFFSET = -77;
+
+static void offset_rgb_channels(uint8_t* data, size_t byte_count, int32_t offset) {
+	/* Looping over bytes rather than pixels, with every fourth (alpha) byte selected rather than branched around, keeps
+	 * the loop body free of branches and cross-byte dependencies so the compiler can vectorise it. */
+	for (size_t index = 0; index < byte_count; ++index) {
+		const int32_t value = data[index];
+		const int32_t offset_value = std::clamp(value + offset, 0, 255);
+		data[index] = static_cast<uint8_t>((index & 3) == 3 ? value : offset_value);
+	}
+}
+
+static void greyscale_rgb_channels(uint8_t* data, size_t byte_count) {
+	/* Rec. 709 luma weights, as used by Color::get_luminance, scaled to sum to 256. */
+	static constexpr uint32_t RED_WEIGHT = 54, GREEN_WEIGHT = 183, BLUE_WEIGHT = 19;
+
+	for (size_t index = 0; index + 3 < byte_count; index += 4) {
+		const uint8_t luma = (RED_WEIGHT * data[index] + GREEN_WEIGHT * data[index + 1] + BLUE_WEIGHT * data[index + 2]) >> 8;
+		data[index] = luma;
+		data[index + 1] = luma;
+		data[index + 2] = luma;
+	}
+}
+
+Ref<Image> GFXButtonStateTexture::make_state_image(
+	ButtonState button_state, Ref<Image> const& source_image, Rect2i const& region
 ) {
-	ERR_FAIL_COND_V(source_image.is_null() || source_image->is_empty(), FAILED);
+	ERR_FAIL_COND_V(source_image.is_null() || source_image->is_empty() || source_image->is_compressed(), nullptr);
 	const Rect2i source_image_rect { {}, source_image->get_size() };
-	ERR_FAIL_COND_V(!region.has_area() || !source_image_rect.encloses(region), FAILED);
-	/* Whether we've already set the ImageTexture to an image of the right dimensions and format,
-	* and so can update it without creating and setting a new image, or not. */
-	bool can_update = state_image.is_valid() && state_image->get_size() == region.get_size()
-		&& state_image->get_format() == source_image->get_format();
-	if (!can_update) {
-		state_image = Image::create(region.size.width, region.size.height, false, source_image->get_format());
-		ERR_FAIL_NULL_V(state_image, FAILED);
+	ERR_FAIL_COND_V(!region.has_area() || !source_image_rect.encloses(region), nullptr);
+
+	const Ref<Image> region_image = source_image->get_region(region);
+	ERR_FAIL_NULL_V(region_image, nullptr);
+	if (region_image->get_format() != Image::FORMAT_RGBA8) {
+		region_image->convert(Image::FORMAT_RGBA8);
 	}
 
-	if (state_texture.is_null()) {
-		can_update = false;
-		state_texture.instantiate();
-		ERR_FAIL_NULL_V(state_texture, FAILED);
-		set_atlas(state_texture);
-		set_region({ {}, state_image->get_size() });
+	PackedByteArray data = region_image->get_data();
+	uint8_t* data_ptr = data.ptrw();
+	const size_t byte_count = data.size();
+
+	switch (button_state) {
+		case HOVER:
+			offset_rgb_channels(data_ptr, byte_count, HOVER_OFFSET);
+			break;
+		case PRESSED:
+			offset_rgb_channels(data_ptr, byte_count, PRESSED_OFFSET);
+			break;
+		case DISABLED:
+			greyscale_rgb_channels(data_ptr, byte_count);
+			break;
+		case SELECTED:
+			offset_rgb_channels(data_ptr, byte_count, SELECTED_OFFSET);
+			break;
+		default:
+			ERR_FAIL_V_MSG(nullptr, Utilities::format("Invalid button state: %d", static_cast<int32_t>(button_state)));
 	}
 
-	cornered_tile_border_size = new_cornered_tile_border_size;
+	return Image::create_from_data(region.size.width, region.size.height, false, Image::FORMAT_RGBA8, data);
+}
 
-	static constexpr auto hover_colour = [](Color const& colour) -> Color {
-		return { std::min(colour.r + 0.1f, 1.0f), std::min(colour.g + 0.1f, 1.0f), std::min(colour.b + 0.1f, 1.0f), colour.a };
-	};
-	static constexpr auto pressed_colour = [](Color const& colour) -> Color {
-		return { std::max(colour.r - 0.1f, 0.0f), std::max(colour.g - 0.1f, 0.0f), std::max(colour.b - 0.1f, 0.0f), colour.a };
-	};
-	static constexpr auto disabled_colour = [](Color const& colour) -> Color {
-		const float luma = colour.get_luminance();
-		return { luma, luma, luma, colour.a };
-	};
-	static constexpr auto selected_colour = [](Color const& colour) -> Color {
-		return { std::max(colour.r - 0.3f, 0.0f), std::max(colour.g - 0.3f, 0.0f), std::max(colour.b - 0.3f, 0.0f), colour.a };
-	};
-
-	const auto colour_func =
-		button_state == HOVER ? hover_colour :
-		button_state == PRESSED ? pressed_colour :
-		button_state == DISABLED ? disabled_colour :
-		selected_colour;
-
-	for (Vector2i point { 0, 0 }; point.y < state_image->get_height(); ++point.y) {
-		for (point.x = 0; point.x < state_image->get_width(); ++point.x) {
-			state_image->set_pixelv(point, colour_func(source_image->get_pixelv(region.position + point)));
-		}
+Error GFXButtonStateTexture::generate_state_image(
+	Ref<Image> const& source_image, Rect2i const& region, Vector2i const& new_cornered_tile_border_size,
+	StringName const& shared_source_key
+) {
+	if (!shared_source_key.is_empty()) {
+		AssetManager* asset_manager = AssetManager::get_singleton();
+		ERR_FAIL_NULL_V(asset_manager, FAILED);
+
+		const AssetManager::atlas_region_t state_region =
+			asset_manager->get_button_state_region(button_state, shared_source_key, source_image, region);
+		ERR_FAIL_NULL_V(state_region.page_texture, FAILED);
+
+		/* The shared texture replaces any previously generated unshared one. */
+		state_image.unref();
+		state_texture.unref();
+		shared_state_users = state_region.users;
+
+		cornered_tile_border_size = new_cornered_tile_border_size;
+		set_atlas(state_region.page_texture);
+		set_region(state_region.region);
+		/* Stops filtering from sampling neighbouring images when drawing from an atlas page. */
+		set_filter_clip(state_region.page_image.is_valid());
+		return OK;
 	}
 
+	const Ref<Image> new_state_image = make_state_image(button_state, source_image, region);
+	ERR_FAIL_NULL_V(new_state_image, FAILED);
+
+	/* Whether we've already set the ImageTexture to an image of the right dimensions (the format is always RGBA8),
+	 * and so can update it without creating and setting a new image, or not. */
+	const bool can_update = state_texture.is_valid() && state_image.is_valid()
+		&& state_image->get_size() == new_state_image->get_size();
+
+	state_image = new_state_image;
+	cornered_tile_border_size = new_cornered_tile_border_size;
+	/* Any previously drawn shared variant is no longer in use by this texture. */
+	shared_state_users.unref();
+
 	if (can_update) {
 		state_texture->update(state_image);
 	} else {
+		if (state_texture.is_null()) {
+			state_texture.instantiate();
+			ERR_FAIL_NULL_V(state_texture, FAILED);
+		}
 		state_texture->set_image(state_image);
 	}
+
+	set_atlas(state_texture);
+	set_region({ {}, state_image->get_size() });
+	set_filter_clip(false);
 	return OK;
 }
 
@@ -165,7 +237,9 @@ void GFXButtonStateHavingTexture::_bind_methods() {
 void GFXButtonStateHavingTexture::_update_button_states() {
 	for (Ref<GFXButtonStateTexture>& button_state_texture : button_state_textures) {
 		if (button_state_texture.is_valid()) {
-			button_state_texture->generate_state_image(button_image, get_region(), cornered_tile_border_size);
+			button_state_texture->generate_state_image(
+				button_image, get_region(), cornered_tile_border_size, button_image_key
+			);
 		}
 	}
 }
@@ -174,6 +248,7 @@ void GFXButtonStateHavingTexture::_clear_button_states() {
 	set_atlas(nullptr);
 	set_region({});
 	button_image.unref();
+	button_image_key = {};
 	for (Ref<GFXButtonStateTexture>& button_state_texture : button_state_textures) {
 		button_state_texture.unref();
 	}
@@ -189,7 +264,7 @@ Ref<GFXButtonStateTexture> GFXButtonStateHavingTexture::get_button_state_texture
 	Ref<GFXButtonStateTexture>& button_state_texture = button_state_textures[button_state_index];
 	if (button_state_texture.is_null()) {
 		button_state_texture = GFXButtonStateTexture::make_gfx_button_state_texture(
-			button_state, button_image, get_region(), cornered_tile_border_size
+			button_state, button_image, get_region(), cornered_tile_border_size, button_image_key
 		);
 		ERR_FAIL_NULL_V(button_state_texture, nullptr);
 	}
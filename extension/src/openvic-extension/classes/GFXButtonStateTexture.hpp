@@ -2,6 +2,7 @@
 
 #include <godot_cpp/classes/atlas_texture.hpp>
 #include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
 
 #include <openvic-simulation/utility/Getters.hpp>
 
@@ -40,6 +41,8 @@ namespace OpenVic {
 		ButtonState PROPERTY(button_state, HOVER);
 		godot::Ref<godot::Image> state_image;
 		godot::Ref<godot::ImageTexture> state_texture;
+		/* Held while drawing a variant from the AssetManager's button state cache, so it isn't pruned while in use. */
+		godot::Ref<godot::RefCounted> shared_state_users;
 
 	protected:
 		static void _bind_methods();
@@ -50,17 +53,25 @@ namespace OpenVic {
 		/* Create a GFXButtonStateTexture using the specified godot::Image. Returns nullptr if generate_state_image fails. */
 		static godot::Ref<GFXButtonStateTexture> make_gfx_button_state_texture(
 			ButtonState button_state, godot::Ref<godot::Image> const& source_image, godot::Rect2i const& region,
-			godot::Vector2i const& cornered_tile_border_size
+			godot::Vector2i const& cornered_tile_border_size, godot::StringName const& shared_source_key = {}
 		);
 
 		/* Set the ButtonState to be generated by this class (calling this does not trigger state image generation). */
 		void set_button_state(ButtonState new_button_state);
 
-		/* Generate a modified version of the given region of source_image
-		 * and update the underlying godot::ImageTexture to use it. */
+		/* Create a new RGBA8 image containing the given region of source_image with the ButtonState's colour adjustment
+		 * applied. Returns nullptr if source_image is empty or compressed, or the region isn't entirely inside it. */
+		static godot::Ref<godot::Image> make_state_image(
+			ButtonState button_state, godot::Ref<godot::Image> const& source_image, godot::Rect2i const& region
+		);
+
+		/* Generate a modified version of the given region of source_image and update the underlying godot::ImageTexture
+		 * to use it. If shared_source_key isn't empty, the modified image is instead fetched from (or generated and added
+		 * to) the AssetManager's button state cache under that key, which must uniquely identify source_image's contents
+		 * (e.g. the file it was loaded from) and so source_image must then never be modified after. */
 		godot::Error generate_state_image(
 			godot::Ref<godot::Image> const& source_image, godot::Rect2i const& region,
-			godot::Vector2i const& new_cornered_tile_border_size
+			godot::Vector2i const& new_cornered_tile_border_size, godot::StringName const& shared_source_key = {}
 		);
 
 		static godot::StringName const& button_state_to_name(ButtonState button_state);
@@ -76,6 +87,10 @@ namespace OpenVic {
 		static void _bind_methods();
 
 		godot::Ref<godot::Image> button_image;
+		/* Identifies button_image's contents, e.g. the file it was loaded from, if it's never modified after being set,
+		 * so button state textures can be shared with other textures drawing the same region of the same contents via
+		 * the AssetManager's button state cache. Empty if button_image can't be shared. */
+		godot::StringName button_image_key;
 
 		void _update_button_states();
 		void _clear_button_states();
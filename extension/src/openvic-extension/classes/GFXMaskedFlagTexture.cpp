@@ -1,5 +1,12 @@
 #include "GFXMaskedFlagTexture.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <span>
+
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/variant/vector4.hpp>
+
 #include "openvic-extension/core/Convert.hpp"
 #include "openvic-extension/singletons/AssetManager.hpp"
 #include "openvic-extension/singletons/GameSingleton.hpp"
@@ -10,75 +17,321 @@
 using namespace godot;
 using namespace OpenVic;
 
-Error GFXMaskedFlagTexture::_generate_combined_image() {
-	ERR_FAIL_NULL_V(overlay_image, FAILED);
-	/* Whether we've already set the ImageTexture to an image of the right dimensions and format,
-	 * and so can update it without creating and setting a new image, or not. */
-	bool can_update = button_image.is_valid() && button_image->get_size() == overlay_image->get_size()
-		&& button_image->get_format() == overlay_image->get_format();
-	if (!can_update) {
-		button_image = Image::create(
-			overlay_image->get_width(), overlay_image->get_height(), false, overlay_image->get_format()
-		);
-		ERR_FAIL_NULL_V(button_image, FAILED);
+static constexpr int32_t RGBA8_PIXEL_SIZE = 4;
+static constexpr int32_t RGB8_PIXEL_SIZE = 3;
+
+/* Composite the flag, with alpha taken from the mask, underneath the overlay. combined starts out as a copy of the RGBA8
+ * overlay data and is updated in place, the mask is RGBA8 and the flag is either RGB8 or RGBA8 (as given by
+ * flag_pixel_size). Blending uses integer arithmetic matching Color::blend with the overlay over the masked flag. */
+static void composite_masked_flag(
+	uint8_t* combined, Vector2i const& combined_size, uint8_t const* mask, Vector2i const& mask_size, uint8_t const* flag,
+	int32_t flag_width, int32_t flag_pixel_size, Rect2i const& flag_rect
+) {
+	/* Translation from combined image to mask coordinates, keeping the centres of each image aligned. */
+	const Vector2i centre_translation = (mask_size - combined_size) / 2;
+
+	/* Only the part of the combined image covered by the mask is affected, everything else remains pure overlay. */
+	const Vector2i begin { std::max(-centre_translation.x, 0), std::max(-centre_translation.y, 0) };
+	const Vector2i end {
+		std::min(mask_size.x - centre_translation.x, combined_size.x),
+		std::min(mask_size.y - centre_translation.y, combined_size.y)
+	};
+	if (begin.x >= end.x || begin.y >= end.y) {
+		return;
 	}
 
-	if (combined_texture.is_null()) {
-		can_update = false;
-		combined_texture.instantiate();
-		ERR_FAIL_NULL_V(combined_texture, FAILED);
-		set_atlas(combined_texture);
-		set_region({ {}, button_image->get_size() });
+	/* Rescaling from mask to flag coordinates involves a division, so each column's flag offset is computed once up front
+	 * rather than for every pixel. */
+	memory::vector<int32_t> flag_column_offsets(end.x - begin.x);
+	for (int32_t x = begin.x; x < end.x; ++x) {
+		flag_column_offsets[x - begin.x] =
+			(flag_rect.position.x + (x + centre_translation.x) * flag_rect.size.x / mask_size.x) * flag_pixel_size;
 	}
 
-	if (mask_image.is_valid() && flag_image.is_valid() && flag_image_rect.has_area()) {
-		const Vector2i centre_translation = (mask_image->get_size() - button_image->get_size()) / 2;
+	for (int32_t y = begin.y; y < end.y; ++y) {
+		const int32_t mask_y = y + centre_translation.y;
+		const int32_t flag_y = flag_rect.position.y + mask_y * flag_rect.size.y / mask_size.y;
+
+		uint8_t* combined_pixel = combined + (static_cast<size_t>(y) * combined_size.x + begin.x) * RGBA8_PIXEL_SIZE;
+		uint8_t const* mask_pixel = mask
+			+ (static_cast<size_t>(mask_y) * mask_size.x + begin.x + centre_translation.x) * RGBA8_PIXEL_SIZE;
+		uint8_t const* flag_row = flag + static_cast<size_t>(flag_y) * flag_width * flag_pixel_size;
 
 		for (
-			Vector2i combined_image_point { 0, 0 };
-			combined_image_point.y < button_image->get_height();
-			++combined_image_point.y
+			int32_t const* flag_column_offset = flag_column_offsets.data();
+			flag_column_offset != flag_column_offsets.data() + flag_column_offsets.size();
+			++flag_column_offset, combined_pixel += RGBA8_PIXEL_SIZE, mask_pixel += RGBA8_PIXEL_SIZE
 		) {
+			const uint32_t overlay_alpha = combined_pixel[3];
+			if (overlay_alpha == 255) {
+				/* Opaque overlay pixels completely hide the flag. */
+				continue;
+			}
 
-			for (combined_image_point.x = 0; combined_image_point.x < button_image->get_width(); ++combined_image_point.x) {
+			uint8_t const* flag_pixel = flag_row + *flag_column_offset;
 
-				const Color overlay_image_colour = overlay_image->get_pixelv(combined_image_point);
+			/* Channel weights scaled by 255 * 255, so the blend can be done with a single division per channel. */
+			const uint32_t overlay_weight = overlay_alpha * 255;
+			const uint32_t flag_weight = mask_pixel[3] * (255 - overlay_alpha);
+			const uint32_t total_weight = overlay_weight + flag_weight;
 
-				// Translate to mask_image coordinates, keeping the centres of each image aligned.
-				const Vector2i mask_image_point = combined_image_point + centre_translation;
+			if (total_weight == 0) {
+				std::memset(combined_pixel, 0, RGBA8_PIXEL_SIZE);
+				continue;
+			}
 
-				if (
-					0 <= mask_image_point.x && mask_image_point.x < mask_image->get_width() &&
-					0 <= mask_image_point.y && mask_image_point.y < mask_image->get_height()
-				) {
-					const Color mask_image_colour = mask_image->get_pixelv(mask_image_point);
+			for (int32_t channel = 0; channel < 3; ++channel) {
+				combined_pixel[channel] = static_cast<uint8_t>((
+					combined_pixel[channel] * overlay_weight + flag_pixel[channel] * flag_weight + total_weight / 2
+				) / total_weight);
+			}
+			combined_pixel[3] = static_cast<uint8_t>((total_weight + 127) / 255);
+		}
+	}
+}
 
-					// Rescale from mask_image to flag_image coordinates.
-					const Vector2i flag_image_point =
-						flag_image_rect.position + mask_image_point * flag_image_rect.size / mask_image->get_size();
+Ref<Image> GFXMaskedFlagTexture::_make_combined_image() const {
+	ERR_FAIL_COND_V(overlay_image->get_format() != Image::FORMAT_RGBA8, nullptr);
 
-					Color flag_image_colour = flag_image->get_pixelv(flag_image_point);
-					flag_image_colour.a = mask_image_colour.a;
+	const Vector2i combined_size = overlay_image->get_size();
+	PackedByteArray combined_data = overlay_image->get_data();
 
-					button_image->set_pixelv(combined_image_point, flag_image_colour.blend(overlay_image_colour));
-				} else {
-					button_image->set_pixelv(combined_image_point, overlay_image_colour);
-				}
-			}
+	if (mask_image.is_valid() && flag_image.is_valid() && flag_image_rect.has_area()) {
+		ERR_FAIL_COND_V(mask_image->get_format() != Image::FORMAT_RGBA8, nullptr);
+
+		/* The flag sheet is RGB8, but any other format is converted so the compositing loop only needs to handle two. */
+		Ref<Image> flag_source = flag_image;
+		Rect2i flag_source_rect = flag_image_rect;
+		if (flag_source->get_format() != Image::FORMAT_RGB8 && flag_source->get_format() != Image::FORMAT_RGBA8) {
+			flag_source = flag_image->get_region(flag_image_rect);
+			ERR_FAIL_NULL_V(flag_source, nullptr);
+			flag_source->convert(Image::FORMAT_RGBA8);
+			flag_source_rect.position = {};
 		}
-	} else {
-		button_image->blit_rect(overlay_image, overlay_image->get_used_rect(), {});
+
+		const PackedByteArray mask_data = mask_image->get_data();
+		const PackedByteArray flag_data = flag_source->get_data();
+
+		composite_masked_flag(
+			combined_data.ptrw(), combined_size, mask_data.ptr(), mask_image->get_size(), flag_data.ptr(),
+			flag_source->get_width(),
+			flag_source->get_format() == Image::FORMAT_RGB8 ? RGB8_PIXEL_SIZE : RGBA8_PIXEL_SIZE,
+			flag_source_rect
+		);
 	}
 
-	if (can_update) {
-		combined_texture->update(button_image);
-	} else {
-		combined_texture->set_image(button_image);
+	return Image::create_from_data(combined_size.x, combined_size.y, false, Image::FORMAT_RGBA8, combined_data);
+}
+
+Error GFXMaskedFlagTexture::_generate_combined_image() {
+	ERR_FAIL_NULL_V(overlay_image, FAILED);
+
+	if (shader_mode) {
+		return _update_shader_parameters();
+	}
+
+	AssetManager* asset_manager = AssetManager::get_singleton();
+	ERR_FAIL_NULL_V(asset_manager, FAILED);
+
+	const MaskedFlagCache::key_t key { overlay_file, mask_file, flag_country, flag_type };
+	MaskedFlagCache::masked_flag_t masked_flag = asset_manager->get_masked_flag_cache().get_masked_flag(key);
+
+	if (masked_flag.texture.is_null()) {
+		masked_flag.image = _make_combined_image();
+		ERR_FAIL_NULL_V(masked_flag.image, FAILED);
+		masked_flag.texture = ImageTexture::create_from_image(masked_flag.image);
+		ERR_FAIL_NULL_V(masked_flag.texture, FAILED);
+		masked_flag.button_state_source_key = key.make_button_state_source_key();
+
+		asset_manager->get_masked_flag_cache().add_masked_flag(key, masked_flag);
+	}
+
+	combined_texture = masked_flag.texture;
+	button_image = masked_flag.image;
+	button_image_key = masked_flag.button_state_source_key;
+
+	set_atlas(combined_texture);
+	set_region({ {}, button_image->get_size() });
+	_update_button_states();
+	return OK;
+}
+
+String const& GFXMaskedFlagTexture::get_shader_code() {
+	/* UV covers the overlay, which is centred on the mask, which in turn is stretched over the flag's region of the
+	 * flag sheet. The blend matches Color::blend with the overlay drawn over the flag, using the mask's alpha. */
+	static const String shader_code =
+		"shader_type canvas_item;\n"
+		"\n"
+		"uniform sampler2D mask_texture : filter_nearest;\n"
+		"uniform sampler2D flag_sheet_texture : filter_nearest;\n"
+		"/* Scale (xy) and offset (zw) from overlay UV to mask UV. */\n"
+		"uniform vec4 mask_transform = vec4(1.0, 1.0, 0.0, 0.0);\n"
+		"/* Position (xy) and size (zw) of the flag in flag sheet UV. */\n"
+		"instance uniform vec4 flag_rect;\n"
+		"instance uniform bool has_flag = false;\n"
+		"\n"
+		"varying vec4 modulate;\n"
+		"\n"
+		"void vertex() {\n"
+		"	modulate = COLOR;\n"
+		"}\n"
+		"\n"
+		"void fragment() {\n"
+		"	vec4 overlay = texture(TEXTURE, UV);\n"
+		"	vec2 mask_uv = UV * mask_transform.xy + mask_transform.zw;\n"
+		"	if (has_flag && all(greaterThanEqual(mask_uv, vec2(0.0))) && all(lessThan(mask_uv, vec2(1.0)))) {\n"
+		"		float flag_alpha = texture(mask_texture, mask_uv).a * (1.0 - overlay.a);\n"
+		"		vec3 flag = texture(flag_sheet_texture, flag_rect.xy + mask_uv * flag_rect.zw).rgb;\n"
+		"		float alpha = overlay.a + flag_alpha;\n"
+		"		vec3 colour = alpha > 0.0 ? (overlay.rgb * overlay.a + flag * flag_alpha) / alpha : vec3(0.0);\n"
+		"		COLOR = vec4(colour, alpha) * modulate;\n"
+		"	} else {\n"
+		"		COLOR = overlay * modulate;\n"
+		"	}\n"
+		"}\n";
+	return shader_code;
+}
+
+Error GFXMaskedFlagTexture::_load_shader_material() {
+	shader_material.unref();
+	overlay_texture.unref();
+
+	if (gfx_masked_flag == nullptr) {
+		return OK;
 	}
+
+	AssetManager* asset_manager = AssetManager::get_singleton();
+	ERR_FAIL_NULL_V(asset_manager, FAILED);
+
+	overlay_texture = asset_manager->get_texture(overlay_file);
+	ERR_FAIL_NULL_V_MSG(
+		overlay_texture, FAILED, Utilities::format("Failed to load flag overlay texture: %s", overlay_file)
+	);
+
+	MaskedFlagCache& masked_flag_cache = asset_manager->get_masked_flag_cache();
+
+	shader_material = masked_flag_cache.get_shader_material(gfx_masked_flag);
+	if (shader_material.is_valid()) {
+		return OK;
+	}
+
+	const Ref<Shader> shader = masked_flag_cache.get_shader();
+	ERR_FAIL_NULL_V(shader, FAILED);
+
+	const Ref<ImageTexture> mask_texture = asset_manager->get_texture(mask_file);
+	ERR_FAIL_NULL_V_MSG(mask_texture, FAILED, Utilities::format("Failed to load flag mask texture: %s", mask_file));
+
+	static const StringName param_mask_texture = "mask_texture";
+	static const StringName param_mask_transform = "mask_transform";
+
+	const Vector2i overlay_size = overlay_image->get_size();
+	const Vector2i mask_size = mask_image->get_size();
+	/* Integer division to match the centre alignment used when compositing on the CPU. */
+	const Vector2i centre_translation = (mask_size - overlay_size) / 2;
+	const Vector2 mask_scale = Vector2 { overlay_size } / Vector2 { mask_size };
+	const Vector2 mask_offset = Vector2 { centre_translation } / Vector2 { mask_size };
+
+	Ref<ShaderMaterial> new_shader_material;
+	new_shader_material.instantiate();
+	ERR_FAIL_NULL_V(new_shader_material, FAILED);
+	new_shader_material->set_shader(shader);
+	new_shader_material->set_shader_parameter(param_mask_texture, mask_texture);
+	new_shader_material->set_shader_parameter(
+		param_mask_transform, Vector4 { mask_scale.x, mask_scale.y, mask_offset.x, mask_offset.y }
+	);
+
+	masked_flag_cache.add_shader_material(gfx_masked_flag, new_shader_material);
+	shader_material = new_shader_material;
+
+	return OK;
+}
+
+Error GFXMaskedFlagTexture::_update_shader_parameters() {
+	ERR_FAIL_NULL_V(shader_material, FAILED);
+	ERR_FAIL_NULL_V(overlay_texture, FAILED);
+
+	if (flag_image.is_valid() && flag_image_rect.has_area()) {
+		static const StringName param_flag_sheet_texture = "flag_sheet_texture";
+
+		GameSingleton const* game_singleton = GameSingleton::get_singleton();
+		ERR_FAIL_NULL_V(game_singleton, FAILED);
+
+		/* The flag sheet is replaced whenever it's regenerated, so is checked rather than only set with the material. */
+		const Ref<ImageTexture> flag_sheet_texture = game_singleton->get_flag_sheet_texture();
+		if (shader_material->get_shader_parameter(param_flag_sheet_texture) != Variant { flag_sheet_texture }) {
+			shader_material->set_shader_parameter(param_flag_sheet_texture, flag_sheet_texture);
+		}
+	}
+
+	if (get_atlas() != overlay_texture) {
+		set_atlas(overlay_texture);
+		set_region({ {}, overlay_image->get_size() });
+	}
+
+	button_image = overlay_image;
+	button_image_key = overlay_file;
 	_update_button_states();
+
+	/* Emitted even if the atlas hasn't changed, as the flag's instance parameters still need reapplying. */
+	emit_changed();
 	return OK;
 }
 
+void GFXMaskedFlagTexture::apply_shader_instance_parameters(CanvasItem* canvas_item) const {
+	ERR_FAIL_NULL(canvas_item);
+
+	static const StringName param_flag_rect = "flag_rect";
+	static const StringName param_has_flag = "has_flag";
+
+	const bool has_flag = flag_image.is_valid() && flag_image_rect.has_area();
+	canvas_item->set_instance_shader_parameter(param_has_flag, has_flag);
+
+	if (has_flag) {
+		const Vector2 flag_sheet_size { flag_image->get_size() };
+		const Vector2 flag_position = Vector2 { flag_image_rect.position } / flag_sheet_size;
+		const Vector2 flag_size = Vector2 { flag_image_rect.size } / flag_sheet_size;
+
+		canvas_item->set_instance_shader_parameter(
+			param_flag_rect, Vector4 { flag_position.x, flag_position.y, flag_size.x, flag_size.y }
+		);
+	}
+}
+
+Error GFXMaskedFlagTexture::set_shader_mode(bool enabled) {
+	if (enabled == shader_mode) {
+		return OK;
+	}
+
+	shader_mode = enabled;
+
+	if (shader_mode) {
+		/* The combined texture is no longer needed, releasing it so it can be pruned from the masked flag cache. */
+		combined_texture.unref();
+
+		if (_load_shader_material() != OK) {
+			shader_mode = false;
+			ERR_FAIL_V(FAILED);
+		}
+	} else {
+		shader_material.unref();
+		overlay_texture.unref();
+	}
+
+	if (overlay_image.is_null()) {
+		return OK;
+	}
+
+	return _generate_combined_image();
+}
+
+bool GFXMaskedFlagTexture::is_shader_mode() const {
+	return shader_mode;
+}
+
+Ref<ShaderMaterial> GFXMaskedFlagTexture::get_shader_material() const {
+	return shader_material;
+}
+
 void GFXMaskedFlagTexture::_bind_methods() {
 	OV_BIND_METHOD(GFXMaskedFlagTexture::clear);
 
@@ -89,10 +342,20 @@ void GFXMaskedFlagTexture::_bind_methods() {
 	OV_BIND_METHOD(GFXMaskedFlagTexture::set_flag_country_name, { "new_flag_country_name" });
 	OV_BIND_METHOD(GFXMaskedFlagTexture::get_flag_country_name);
 	OV_BIND_METHOD(GFXMaskedFlagTexture::get_flag_type);
+
+	OV_BIND_METHOD(GFXMaskedFlagTexture::set_shader_mode, { "enabled" });
+	OV_BIND_METHOD(GFXMaskedFlagTexture::is_shader_mode);
+	OV_BIND_METHOD(GFXMaskedFlagTexture::get_shader_material);
+	OV_BIND_METHOD(GFXMaskedFlagTexture::apply_shader_instance_parameters, { "canvas_item" });
+	OV_BIND_SMETHOD(get_shader_code);
 }
 
 GFXMaskedFlagTexture::GFXMaskedFlagTexture() {}
 
+GFXMaskedFlagTexture::~GFXMaskedFlagTexture() {
+	_set_flag_country_instance_index(std::nullopt);
+}
+
 Ref<GFXMaskedFlagTexture> GFXMaskedFlagTexture::make_gfx_masked_flag_texture(GFX::MaskedFlag const* gfx_masked_flag) {
 	Ref<GFXMaskedFlagTexture> masked_flag_texture;
 	masked_flag_texture.instantiate();
@@ -107,12 +370,35 @@ void GFXMaskedFlagTexture::clear() {
 	gfx_masked_flag = nullptr;
 	flag_country = nullptr;
 	flag_type = String {};
+	_set_flag_country_instance_index(std::nullopt);
 
 	_clear_button_states();
+	combined_texture.unref();
 
+	overlay_file = String {};
+	mask_file = String {};
 	overlay_image.unref();
 	mask_image.unref();
 	flag_image.unref();
+
+	shader_material.unref();
+	overlay_texture.unref();
+}
+
+Ref<Image> GFXMaskedFlagTexture::_make_rgba8_image(Ref<Image> const& image) {
+	ERR_FAIL_NULL_V(image, nullptr);
+
+	if (image->get_format() == Image::FORMAT_RGBA8) {
+		return image;
+	}
+
+	/* The original image may be in the AssetManager's cache, so it's copied rather than converted in place. */
+	Ref<Image> rgba8_image;
+	rgba8_image.instantiate();
+	ERR_FAIL_NULL_V(rgba8_image, nullptr);
+	rgba8_image->copy_from(image);
+	rgba8_image->convert(Image::FORMAT_RGBA8);
+	return rgba8_image;
 }
 
 Error GFXMaskedFlagTexture::set_gfx_masked_flag(GFX::MaskedFlag const* new_gfx_masked_flag) {
@@ -128,17 +414,28 @@ Error GFXMaskedFlagTexture::set_gfx_masked_flag(GFX::MaskedFlag const* new_gfx_m
 	AssetManager* asset_manager = AssetManager::get_singleton();
 	ERR_FAIL_NULL_V(asset_manager, FAILED);
 
-	const StringName overlay_file = convert_to<String>(new_gfx_masked_flag->get_overlay_file());
-	const Ref<Image> new_overlay_image = asset_manager->get_image(overlay_file);
-	ERR_FAIL_NULL_V_MSG(new_overlay_image, FAILED, Utilities::format("Failed to load flag overlay image: %s", overlay_file));
+	const StringName new_overlay_file = convert_to<String>(new_gfx_masked_flag->get_overlay_file());
+	const Ref<Image> new_overlay_image = asset_manager->get_image(new_overlay_file);
+	ERR_FAIL_NULL_V_MSG(
+		new_overlay_image, FAILED, Utilities::format("Failed to load flag overlay image: %s", new_overlay_file)
+	);
 
-	const StringName mask_file = convert_to<String>(new_gfx_masked_flag->get_mask_file());
-	const Ref<Image> new_mask_image = asset_manager->get_image(mask_file);
-	ERR_FAIL_NULL_V_MSG(new_mask_image, FAILED, Utilities::format("Failed to load flag mask image: %s", mask_file));
+	const StringName new_mask_file = convert_to<String>(new_gfx_masked_flag->get_mask_file());
+	const Ref<Image> new_mask_image = asset_manager->get_image(new_mask_file);
+	ERR_FAIL_NULL_V_MSG(new_mask_image, FAILED, Utilities::format("Failed to load flag mask image: %s", new_mask_file));
 
 	gfx_masked_flag = new_gfx_masked_flag;
-	overlay_image = new_overlay_image;
-	mask_image = new_mask_image;
+	overlay_file = new_overlay_file;
+	mask_file = new_mask_file;
+	/* Converted once here rather than on every regeneration, so the compositing loop can work on raw RGBA8 data. */
+	overlay_image = _make_rgba8_image(new_overlay_image);
+	ERR_FAIL_NULL_V(overlay_image, FAILED);
+	mask_image = _make_rgba8_image(new_mask_image);
+	ERR_FAIL_NULL_V(mask_image, FAILED);
+
+	if (shader_mode) {
+		ERR_FAIL_COND_V(_load_shader_material() != OK, FAILED);
+	}
 
 	return _generate_combined_image();
 }
@@ -169,6 +466,76 @@ String GFXMaskedFlagTexture::get_gfx_masked_flag_name() const {
 
 Error GFXMaskedFlagTexture::set_flag_country_and_type(
 	CountryDefinition const* new_flag_country, StringName const& new_flag_type
+) {
+	_set_flag_country_instance_index(std::nullopt);
+	return _set_flag_country_and_type(new_flag_country, new_flag_type);
+}
+
+void GFXMaskedFlagTexture::_set_flag_country_instance_index(
+	std::optional<country_index_t> new_flag_country_instance_index
+) {
+	if (flag_country_instance_index == new_flag_country_instance_index) {
+		return;
+	}
+
+	GameSingleton* game_singleton = GameSingleton::get_singleton();
+
+	if (!flag_country_instance_index.has_value()) {
+		ERR_FAIL_NULL(game_singleton);
+		game_singleton->gamestate_updated.connect(&GFXMaskedFlagTexture::_on_gamestate_updated, this);
+	} else if (!new_flag_country_instance_index.has_value() && game_singleton != nullptr) {
+		/* If the GameSingleton has already been destroyed then so has the connection. */
+		game_singleton->gamestate_updated.disconnect(&GFXMaskedFlagTexture::_on_gamestate_updated, this);
+	}
+
+	flag_country_instance_index = new_flag_country_instance_index;
+	flag_government_type = nullptr;
+}
+
+CountryInstance const* GFXMaskedFlagTexture::_get_flag_country_instance() const {
+	if (!flag_country_instance_index.has_value()) {
+		return nullptr;
+	}
+
+	GameSingleton const* game_singleton = GameSingleton::get_singleton();
+	ERR_FAIL_NULL_V(game_singleton, nullptr);
+
+	/* There is no InstanceManager between sessions. */
+	InstanceManager const* instance_manager = game_singleton->get_instance_manager();
+	if (instance_manager == nullptr) {
+		return nullptr;
+	}
+
+	const std::span<const CountryInstance> countries =
+		instance_manager->get_country_instance_manager().get_country_instances();
+	const size_t index = type_safe::get(*flag_country_instance_index);
+
+	return index < countries.size() ? &countries[index] : nullptr;
+}
+
+void GFXMaskedFlagTexture::_on_gamestate_updated() {
+	CountryInstance const* flag_country_instance = _get_flag_country_instance();
+	if (flag_country_instance == nullptr) {
+		return;
+	}
+
+	/* Comparing pointers avoids converting the flag type to a StringName every update when nothing has changed. */
+	GovernmentType const* government_type = flag_country_instance->flag_government_type.get_untracked();
+	if (government_type == flag_government_type) {
+		return;
+	}
+
+	flag_government_type = government_type;
+
+	const StringName new_flag_type = government_type != nullptr
+		? StringName { convert_to<String>(government_type->get_flag_type()) }
+		: StringName {};
+
+	_set_flag_country_and_type(&flag_country_instance->country_definition, new_flag_type);
+}
+
+Error GFXMaskedFlagTexture::_set_flag_country_and_type(
+	CountryDefinition const* new_flag_country, StringName const& new_flag_type
 ) {
 	if (flag_country == new_flag_country && flag_type == new_flag_type) {
 		return OK;
@@ -219,13 +586,16 @@ Error GFXMaskedFlagTexture::set_flag_country(CountryInstance* new_flag_country)
 		return set_flag_country_and_type(nullptr, {});
 	}
 
+	_set_flag_country_instance_index(new_flag_country->country_definition.index);
+
 	GovernmentType const* government_type = new_flag_country->flag_government_type.get_untracked();
+	flag_government_type = government_type;
 
 	const StringName new_flag_type = government_type != nullptr
 		? StringName { convert_to<String>(government_type->get_flag_type()) }
 		: StringName {};
 
-	return set_flag_country_and_type(&new_flag_country->country_definition, new_flag_type);
+	return _set_flag_country_and_type(&new_flag_country->country_definition, new_flag_type);
 }
 
 Error GFXMaskedFlagTexture::set_flag_country_name(String const& new_flag_country_name) {
@@ -1,12 +1,19 @@
 #pragma once
 
+#include <optional>
+
+#include <godot_cpp/classes/canvas_item.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+
 #include <openvic-simulation/interface/GFXSprite.hpp>
+#include <openvic-simulation/types/TypedIndices.hpp>
 
 #include "openvic-extension/classes/GFXButtonStateTexture.hpp"
 
 namespace OpenVic {
 	struct CountryDefinition;
 	struct CountryInstance;
+	struct GovernmentType;
 
 	class GFXMaskedFlagTexture : public GFXButtonStateHavingTexture {
 		GDCLASS(GFXMaskedFlagTexture, GFXButtonStateHavingTexture)
@@ -15,17 +22,49 @@ namespace OpenVic {
 		CountryDefinition const* PROPERTY(flag_country, nullptr);
 		godot::StringName PROPERTY(flag_type);
 
+		/* Set when following a CountryInstance's flag type, which is then rechecked whenever the gamestate is updated. The
+		 * country is looked up by index on each update, as every new session replaces the InstanceManager. */
+		std::optional<country_index_t> flag_country_instance_index;
+		GovernmentType const* flag_government_type = nullptr;
+
+		godot::StringName overlay_file, mask_file;
+		/* overlay_image and mask_image are always RGBA8, flag_image is the GameSingleton's flag sheet. */
 		godot::Ref<godot::Image> overlay_image, mask_image, flag_image;
 		godot::Rect2i flag_image_rect;
+		/* Shared with every other GFXMaskedFlagTexture showing the same masked flag, via the AssetManager's cache. */
 		godot::Ref<godot::ImageTexture> combined_texture;
 
+		bool shader_mode = false;
+		/* Only set in shader mode, along with the overlay texture it draws. The material is shared with every other shader
+		 * mode texture using the same GFX::MaskedFlag, via the AssetManager's masked flag cache, so the flag itself is
+		 * given to it as per-instance shader parameters. */
+		godot::Ref<godot::ShaderMaterial> shader_material;
+		godot::Ref<godot::ImageTexture> overlay_texture;
+
+		godot::Error _load_shader_material();
+		godot::Error _update_shader_parameters();
+
+		/* Return image if it's already RGBA8, otherwise an RGBA8 copy of it. */
+		static godot::Ref<godot::Image> _make_rgba8_image(godot::Ref<godot::Image> const& image);
+
+		/* Composite the flag under the overlay into a new RGBA8 image. */
+		godot::Ref<godot::Image> _make_combined_image() const;
 		godot::Error _generate_combined_image();
 
+		godot::Error _set_flag_country_and_type(
+			CountryDefinition const* new_flag_country, godot::StringName const& new_flag_type
+		);
+		void _set_flag_country_instance_index(std::optional<country_index_t> new_flag_country_instance_index);
+		/* The followed CountryInstance in the current session, or nullptr if there isn't one. */
+		CountryInstance const* _get_flag_country_instance() const;
+		void _on_gamestate_updated();
+
 	protected:
 		static void _bind_methods();
 
 	public:
 		GFXMaskedFlagTexture();
+		~GFXMaskedFlagTexture();
 
 		/* Create a GFXMaskedFlagTexture using the specified GFX::MaskedFlag. Returns nullptr if gfx_masked_flag fails. */
 		static godot::Ref<GFXMaskedFlagTexture> make_gfx_masked_flag_texture(GFX::MaskedFlag const* gfx_masked_flag);
@@ -54,8 +93,9 @@ namespace OpenVic {
 			godot::String const& new_flag_country_name, godot::StringName const& new_flag_type
 		);
 
-		/* Look up the specified country's current flag type, then call set_flag_country_and_type
-		 * with the country and its flag type as arguments. */
+		/* Look up the specified country's current flag type, then call set_flag_country_and_type with the country and its
+		 * flag type as arguments. The country's flag type is rechecked every time the gamestate is updated, so the flag
+		 * follows changes of government until a different flag country is set. */
 		godot::Error set_flag_country(CountryInstance* new_flag_country);
 
 		/* Look up the country with the specified identifier, then call set_flag_country with the country as its argument. */
@@ -63,5 +103,25 @@ namespace OpenVic {
 
 		/* Return the name of the selected flag's country, or an empty String if it's null. */
 		godot::String get_flag_country_name() const;
+
+		/* Enable or disable shader mode. In shader mode the texture only contains the overlay, and the masked flag is
+		 * composited underneath it at draw time by the material returned by get_shader_material, which must be set on
+		 * whatever draws this texture along with the parameters set by apply_shader_instance_parameters. Changing the
+		 * flag then only costs an instance parameter update rather than regenerating and uploading the combined image,
+		 * and every flag using the same GFX::MaskedFlag shares one material so can still be batched together. The
+		 * changed signal is emitted whenever the instance parameters need reapplying. Button state textures are
+		 * generated from the overlay alone, so shader mode isn't suitable for flags drawn as buttons. */
+		godot::Error set_shader_mode(bool enabled);
+		bool is_shader_mode() const;
+
+		/* Return the material to draw this texture with in shader mode, or nullptr if shader mode is disabled or there
+		 * is no GFX::MaskedFlag. */
+		godot::Ref<godot::ShaderMaterial> get_shader_material() const;
+
+		/* Set the flag's per-instance shader parameters on the canvas item drawing this texture in shader mode. */
+		void apply_shader_instance_parameters(godot::CanvasItem* canvas_item) const;
+
+		/* Source code for the canvas item shader used in shader mode. */
+		static godot::String const& get_shader_code();
 	};
 }
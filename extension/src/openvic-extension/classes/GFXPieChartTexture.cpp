@@ -1,9 +1,19 @@
 #include "GFXPieChartTexture.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <mutex>
 #include <numbers>
 
+#include <godot_cpp/variant/vector4i.hpp>
+
+#include "openvic-extension/classes/GUILabel.hpp"
 #include "openvic-extension/core/Bind.hpp"
 #include "openvic-extension/core/Convert.hpp"
+#include "openvic-extension/singletons/AssetManager.hpp"
+#include "openvic-extension/singletons/MenuSingleton.hpp"
 #include "openvic-extension/utility/UITools.hpp"
 #include "openvic-extension/utility/Utilities.hpp"
 
@@ -28,34 +38,108 @@ StringName const& GFXPieChartTexture::_slice_weight_key() {
 	return slice_weight_key;
 }
 
+static constexpr float TWO_PI = 2.0f * std::numbers::pi_v<float>;
+
+/* Calculate the anti-clockwise angle between the point and the centre of the image, as a fraction of a full rotation.
+ * The y coordinate is negated as the image coordinate system's y increases downwards. */
+static float get_angle_fraction(float x, float y) {
+	const float fraction = std::atan2(-y, x) / TWO_PI;
+	return fraction < 0.0f ? fraction + 1.0f : fraction;
+}
+
+std::span<const float> GFXPieChartTexture::_get_angle_lookup(int32_t radius) {
+	/* Lookups are never modified once built, so spans of them stay valid after the lock is released, even if the map
+	 * later moves them while growing (moving a vector keeps its buffer). */
+	static std::mutex angle_lookups_mutex;
+	static ordered_map<int32_t, memory::vector<float>> angle_lookups;
+
+	const std::lock_guard lock { angle_lookups_mutex };
+
+	memory::vector<float>& angle_lookup = angle_lookups[radius];
+
+	if (angle_lookup.empty()) {
+		const int32_t diameter = 2 * radius;
+		angle_lookup.resize(static_cast<size_t>(diameter) * diameter);
+
+		float* angle = angle_lookup.data();
+		for (int32_t y = 0; y < diameter; ++y) {
+			// Move to the centre of the pixel, normalise to [0, 2] and translate to [-1, 1]
+			const float offset_y = (y + 0.5f) / radius - 1.0f;
+
+			for (int32_t x = 0; x < diameter; ++x, ++angle) {
+				const float offset_x = (x + 0.5f) / radius - 1.0f;
+
+				*angle = offset_x * offset_x + offset_y * offset_y > 1.0f ? -1.0f : get_angle_fraction(offset_x, offset_y);
+			}
+		}
+	}
+
+	return angle_lookup;
+}
+
+size_t GFXPieChartTexture::_get_slice_index(float angle) const {
+	/* Find the first slice ending at or after the angle. */
+	const std::vector<float>::const_iterator it = std::lower_bound(slice_ends.begin(), slice_ends.end(), angle);
+
+	/* Default to the first slice in case the angle is past the last slice's end due to floating point inaccuracy. */
+	return it != slice_ends.end() ? it - slice_ends.begin() : 0;
+}
+
 GFXPieChartTexture::slice_t const* GFXPieChartTexture::get_slice(Vector2 const& position) const {
 	if (slices.empty() || position.length_squared() > 1.0_real) {
 		return nullptr;
 	}
 
-	static constexpr float TWO_PI = 2.0f * std::numbers::pi_v<float>;
+	return &slices[_get_slice_index(get_angle_fraction(position.x, position.y))];
+}
+
+PieChartCache::key_t GFXPieChartTexture::_make_pie_chart_key(int32_t radius) const {
+	PieChartCache::key_t key { radius, {} };
+	key.slice_signature.reserve(2 * slices.size());
 
-	/* Calculate the anti-clockwise angle between the point and the centre of the image.
-	 * The y coordinate is negated as the image coordinate system's y increases downwards. */
-	float theta = atan2(-position.y, position.x);
-	if (theta < 0.0f) {
-		theta += TWO_PI;
+	for (size_t index = 0; index < slices.size(); ++index) {
+		key.slice_signature.push_back(slices[index].colour.to_rgba32());
+		key.slice_signature.push_back(
+			static_cast<uint32_t>(std::lround(slice_ends[index] * PieChartCache::ANGLE_STEPS))
+		);
 	}
 
-	/* Rescale angle so that total_weight is a full rotation. */
-	theta *= total_weight / TWO_PI;
+	return key;
+}
+
+Ref<Image> GFXPieChartTexture::_draw_pie_chart_image(int32_t radius) const {
+	static constexpr size_t PIXEL_SIZE = 4;
+
+	const int32_t diameter = 2 * radius;
+
+	PackedByteArray pixels;
+	ERR_FAIL_COND_V(pixels.resize(static_cast<int64_t>(diameter) * diameter * PIXEL_SIZE) != OK, nullptr);
+	uint8_t* pixel = pixels.ptrw();
+
+	if (!slices.empty()) {
+		memory::vector<std::array<uint8_t, PIXEL_SIZE>> slice_colours;
+		slice_colours.reserve(slices.size());
+		for (slice_t const& slice : slices) {
+			slice_colours.push_back({
+				static_cast<uint8_t>(slice.colour.get_r8()), static_cast<uint8_t>(slice.colour.get_g8()),
+				static_cast<uint8_t>(slice.colour.get_b8()), static_cast<uint8_t>(slice.colour.get_a8())
+			});
+		}
+
+		static constexpr std::array<uint8_t, PIXEL_SIZE> background_colour { 0, 0, 0, 0 };
 
-	/* Find the slice theta lies in. */
-	for (slice_t const& slice : slices) {
-		theta -= slice.weight;
+		for (const float angle : _get_angle_lookup(radius)) {
+			std::array<uint8_t, PIXEL_SIZE> const& colour =
+				angle < 0.0f ? background_colour : slice_colours[_get_slice_index(angle)];
 
-		if (theta <= 0.0f) {
-			return &slice;
+			std::memcpy(pixel, colour.data(), PIXEL_SIZE);
+			pixel += PIXEL_SIZE;
 		}
+	} else {
+		std::memset(pixel, 0, pixels.size());
 	}
 
-	/* Default to the first slice in case theta never reaches 0 due to floating point inaccuracy. */
-	return &slices.front();
+	return Image::create_from_data(diameter, diameter, false, Image::FORMAT_RGBA8, pixels);
 }
 
 Error GFXPieChartTexture::_generate_pie_chart_image() {
@@ -68,54 +152,200 @@ Error GFXPieChartTexture::_generate_pie_chart_image() {
 	const int32_t pie_chart_radius = gfx_pie_chart->get_size();
 	const int32_t pie_chart_diameter = 2 * pie_chart_radius;
 
-	/* Whether we've already set the ImageTexture to an image of the right dimensions,
-	 * and so can update it without creating and setting a new image, or not. */
-	const bool can_update = pie_chart_image.is_valid() && pie_chart_image->get_width() == pie_chart_diameter
-		&& pie_chart_image->get_height() == pie_chart_diameter;
+	/* In shader mode the texture is left blank, only being needed to give the pie chart its size, so the same texture
+	 * is shared by every shader mode pie chart of the same radius. */
+	const bool shader_drawn = shader_material.is_valid() && slices.size() <= MAX_SHADER_SLICES;
+
+	PieChartCache::key_t key = shader_drawn
+		? PieChartCache::key_t { pie_chart_radius, {} }
+		: _make_pie_chart_key(pie_chart_radius);
+
+	/* Rows are refreshed far more often than their contents change, in which case there's nothing to redraw or upload. */
+	if (pie_chart_texture.is_null() || key != pie_chart_key) {
+		AssetManager* asset_manager = AssetManager::get_singleton();
+		ERR_FAIL_NULL_V(asset_manager, FAILED);
+
+		Ref<ImageTexture> texture = asset_manager->get_pie_chart_cache().get_pie_chart_texture(key);
+		if (texture.is_null()) {
+			const Ref<Image> image = shader_drawn
+				? Image::create(pie_chart_diameter, pie_chart_diameter, false, Image::FORMAT_RGBA8)
+				: _draw_pie_chart_image(pie_chart_radius);
+			ERR_FAIL_NULL_V(image, FAILED);
+			texture = ImageTexture::create_from_image(image);
+			ERR_FAIL_NULL_V(texture, FAILED);
+			asset_manager->get_pie_chart_cache().add_pie_chart_texture(key, texture);
+		}
+
+		pie_chart_texture = texture;
+		pie_chart_key = std::move(key);
 
-	if (!can_update) {
-		pie_chart_image = Image::create(pie_chart_diameter, pie_chart_diameter, false, Image::FORMAT_RGBA8);
-		ERR_FAIL_NULL_V(pie_chart_image, FAILED);
+		set_atlas(pie_chart_texture);
+		set_region({ {}, pie_chart_texture->get_size() });
 	}
 
-	static const Color background_colour { 0.0f, 0.0f, 0.0f, 0.0f };
+	if (shader_material.is_valid()) {
+		/* Emitted even if the atlas hasn't changed, as the slices' instance parameters still need reapplying. */
+		emit_changed();
+	}
 
-	if (!slices.empty()) {
-		for (Vector2i point { 0, 0 }; point.y < pie_chart_diameter; ++point.y) {
+	return OK;
+}
 
-			for (point.x = 0; point.x < pie_chart_diameter; ++point.x) {
+static String shader_uniform_name(String const& prefix, size_t index) {
+	return prefix + String::num_uint64(index);
+}
 
-				Vector2 offset = point;
-				// Move to the centre of the pixel
-				offset += Vector2 { 0.5_real, 0.5_real };
-				// Normalise to [0, 2]
-				offset /= pie_chart_radius;
-				// Translate to [-1, 1]
-				offset -= Vector2 { 1.0_real, 1.0_real };
+String const& GFXPieChartTexture::get_shader_code() {
+	/* Matches the CPU path: each slice ends at an angle given as a fraction of a full rotation, anti-clockwise from
+	 * the positive x axis, and the slice for each fragment is found with a binary search. */
+	static const String shader_code = []() -> String {
+		String colour_uniforms, end_uniforms, colour_array, end_array;
+		for (size_t index = 0; index < SHADER_COLOUR_UNIFORM_COUNT; ++index) {
+			const String name = shader_uniform_name("slice_colours_", index);
+			colour_uniforms += "instance uniform ivec4 " + name + ";\n";
+			colour_array += (index > 0 ? ", " : "") + name;
+		}
+		for (size_t index = 0; index < SHADER_END_UNIFORM_COUNT; ++index) {
+			const String name = shader_uniform_name("slice_ends_", index);
+			end_uniforms += "instance uniform ivec4 " + name + ";\n";
+			end_array += (index > 0 ? ", " : "") + name;
+		}
+		const String colours_per_uniform = String::num_uint64(SHADER_COLOURS_PER_UNIFORM);
+		const String ends_per_uniform = String::num_uint64(SHADER_ENDS_PER_UNIFORM);
+
+		return
+			"shader_type canvas_item;\n"
+			"\n"
+			"/* Negative when there are too many slices to pack, in which case the texture is drawn unchanged. */\n"
+			"instance uniform int slice_count = 0;\n"
+			"/* RGBA8 colours, with red in the lowest byte. */\n" + colour_uniforms +
+			"/* Slice ends in 16-bit fixed point, with even slices in the lower half of each component. */\n" + end_uniforms +
+			"\n"
+			"varying vec4 modulate;\n"
+			"\n"
+			"void vertex() {\n"
+			"	modulate = COLOR;\n"
+			"}\n"
+			"\n"
+			"void fragment() {\n"
+			"	vec2 offset = UV * 2.0 - 1.0;\n"
+			"	if (slice_count < 0) {\n"
+			"		COLOR = texture(TEXTURE, UV) * modulate;\n"
+			"	} else if (slice_count == 0 || dot(offset, offset) > 1.0) {\n"
+			"		COLOR = vec4(0.0);\n"
+			"	} else {\n"
+			"		ivec4 colours[" + String::num_uint64(SHADER_COLOUR_UNIFORM_COUNT) + "] = { " + colour_array + " };\n"
+			"		ivec4 ends[" + String::num_uint64(SHADER_END_UNIFORM_COUNT) + "] = { " + end_array + " };\n"
+			"		float angle = atan(-offset.y, offset.x) / TAU;\n"
+			"		if (angle < 0.0) {\n"
+			"			angle += 1.0;\n"
+			"		}\n"
+			"		int low = 0;\n"
+			"		int high = slice_count;\n"
+			"		while (low < high) {\n"
+			"			int mid = (low + high) / 2;\n"
+			"			int packed_ends = ends[mid / " + ends_per_uniform + "][(mid / 2) % 4];\n"
+			"			if (unpackUnorm2x16(uint(packed_ends))[mid % 2] < angle) {\n"
+			"				low = mid + 1;\n"
+			"			} else {\n"
+			"				high = mid;\n"
+			"			}\n"
+			"		}\n"
+			"		int index = low < slice_count ? low : 0;\n"
+			"		int packed_colour = colours[index / " + colours_per_uniform + "][index % " + colours_per_uniform + "];\n"
+			"		COLOR = unpackUnorm4x8(uint(packed_colour)) * modulate;\n"
+			"	}\n"
+			"}\n";
+	}();
+	return shader_code;
+}
 
-				slice_t const* slice = get_slice(offset);
+void GFXPieChartTexture::apply_shader_instance_parameters(CanvasItem* canvas_item) const {
+	ERR_FAIL_NULL(canvas_item);
 
-				pie_chart_image->set_pixelv(point, slice != nullptr ? slice->colour : background_colour);
-			}
+	static const StringName param_slice_count = "slice_count";
+	static const std::array<StringName, SHADER_COLOUR_UNIFORM_COUNT> param_slice_colours = []() {
+		std::array<StringName, SHADER_COLOUR_UNIFORM_COUNT> names;
+		for (size_t index = 0; index < names.size(); ++index) {
+			names[index] = shader_uniform_name("slice_colours_", index);
 		}
-	} else {
+		return names;
+	}();
+	static const std::array<StringName, SHADER_END_UNIFORM_COUNT> param_slice_ends = []() {
+		std::array<StringName, SHADER_END_UNIFORM_COUNT> names;
+		for (size_t index = 0; index < names.size(); ++index) {
+			names[index] = shader_uniform_name("slice_ends_", index);
+		}
+		return names;
+	}();
+
+	if (slices.size() > MAX_SHADER_SLICES) {
+		canvas_item->set_instance_shader_parameter(param_slice_count, -1);
+		return;
+	}
 
-		pie_chart_image->fill(background_colour);
+	/* Unused trailing values are left as zero, as the shader never reads past slice_count. */
+	std::array<uint32_t, MAX_SHADER_SLICES> colours {};
+	std::array<uint32_t, MAX_SHADER_SLICES / 2> ends {};
+	for (size_t index = 0; index < slices.size(); ++index) {
+		colours[index] = slices[index].colour.to_abgr32();
+		const uint32_t end = static_cast<uint32_t>(std::lround(std::clamp(slice_ends[index], 0.0f, 1.0f) * 0xFFFF));
+		ends[index / 2] |= end << (index % 2 * 16);
+	}
+
+	/* Each uniform is an ivec4 made from four consecutive packed values, whose bits the shader reinterprets as unsigned. */
+	const auto make_uniform = [](uint32_t const* values) -> Vector4i {
+		return {
+			static_cast<int32_t>(values[0]), static_cast<int32_t>(values[1]), static_cast<int32_t>(values[2]),
+			static_cast<int32_t>(values[3])
+		};
+	};
+
+	canvas_item->set_instance_shader_parameter(param_slice_count, static_cast<int32_t>(slices.size()));
+	for (size_t index = 0; index < SHADER_COLOUR_UNIFORM_COUNT; ++index) {
+		canvas_item->set_instance_shader_parameter(param_slice_colours[index], make_uniform(colours.data() + index * 4));
+	}
+	for (size_t index = 0; index < SHADER_END_UNIFORM_COUNT; ++index) {
+		canvas_item->set_instance_shader_parameter(param_slice_ends[index], make_uniform(ends.data() + index * 4));
+	}
+}
 
+Error GFXPieChartTexture::set_shader_mode(bool enabled) {
+	if (enabled == shader_material.is_valid()) {
+		return OK;
 	}
 
-	if (can_update) {
-		update(pie_chart_image);
+	if (enabled) {
+		AssetManager* asset_manager = AssetManager::get_singleton();
+		ERR_FAIL_NULL_V(asset_manager, FAILED);
+
+		shader_material = asset_manager->get_pie_chart_cache().get_shader_material();
+		ERR_FAIL_NULL_V(shader_material, FAILED);
 	} else {
-		set_image(pie_chart_image);
+		shader_material.unref();
 	}
 
-	return OK;
+	if (gfx_pie_chart == nullptr) {
+		return OK;
+	}
+
+	/* The image isn't drawn into in shader mode, so must be regenerated when leaving it. */
+	return _generate_pie_chart_image();
+}
+
+bool GFXPieChartTexture::is_shader_mode() const {
+	return shader_material.is_valid();
+}
+
+Ref<ShaderMaterial> GFXPieChartTexture::get_shader_material() const {
+	return shader_material;
 }
 
 Error GFXPieChartTexture::set_slices_array(godot_pie_chart_data_t const& new_slices) {
 	slices.clear();
+	slice_ends.clear();
 	total_weight = 0.0f;
+	slice_tooltips_pending = false;
 	for (int32_t i = 0; i < new_slices.size(); ++i) {
 		Dictionary const& slice_dict = new_slices[i];
 		ERR_CONTINUE_MSG(
@@ -130,11 +360,84 @@ Error GFXPieChartTexture::set_slices_array(godot_pie_chart_data_t const& new_sli
 		if (slice.weight > 0.0f) {
 			total_weight += slice.weight;
 			slices.push_back(slice);
+			slice_ends.push_back(total_weight);
+		}
+	}
+	for (float& slice_end : slice_ends) {
+		slice_end /= total_weight;
+	}
+	return _generate_pie_chart_image();
+}
+
+Error GFXPieChartTexture::set_slices_packed(
+	PackedStringArray const& identifiers, PackedColorArray const& colours, PackedFloat32Array const& weights, int64_t start,
+	int64_t end
+) {
+	ERR_FAIL_COND_V_MSG(
+		identifiers.size() != colours.size() || identifiers.size() != weights.size(), FAILED,
+		Utilities::format(
+			"Mismatched packed slice array sizes: %d identifiers, %d colours, %d weights", identifiers.size(), colours.size(),
+			weights.size()
+		)
+	);
+	if (end < 0) {
+		end = weights.size();
+	}
+	ERR_FAIL_COND_V_MSG(
+		start < 0 || start > end || end > weights.size(), FAILED,
+		Utilities::format("Invalid packed slice range [%d, %d) for %d slices", start, end, weights.size())
+	);
+
+	slices.clear();
+	slice_ends.clear();
+	total_weight = 0.0f;
+	slice_tooltips_pending = true;
+	for (int64_t i = start; i < end; ++i) {
+		const float weight = weights[i];
+		if (weight > 0.0f) {
+			total_weight += weight;
+			slices.push_back({ identifiers[i], {}, colours[i], weight });
+			slice_ends.push_back(total_weight);
 		}
 	}
+	for (float& slice_end : slice_ends) {
+		slice_end /= total_weight;
+	}
 	return _generate_pie_chart_image();
 }
 
+String const& GFXPieChartTexture::get_slice_tooltip(slice_t const& slice) {
+	const size_t slice_index = &slice - slices.data();
+	ERR_FAIL_INDEX_V(slice_index, slices.size(), slice.tooltip);
+
+	if (slice_tooltips_pending) {
+		static const String slice_tooltip_format = "%s: " + GUILabel::get_colour_marker() + "Y%s%%" +
+			GUILabel::get_colour_marker() + "!";
+
+		std::vector<String> slice_lines;
+		slice_lines.reserve(slices.size());
+		for (slice_t const& listed_slice : slices) {
+			slice_lines.push_back(Utilities::format(
+				slice_tooltip_format, tr(listed_slice.identifier),
+				Utilities::float_to_string_dp(100.0f * listed_slice.weight / total_weight, 1)
+			));
+		}
+
+		String full_tooltip = MenuSingleton::get_tooltip_separator().trim_suffix("\n");
+		for (String const& slice_line : slice_lines) {
+			full_tooltip += "\n" + slice_line;
+		}
+
+		/* Every slice's tooltip is generated at once as they share the full list. */
+		for (size_t index = 0; index < slices.size(); ++index) {
+			slices[index].tooltip = slice_lines[index] + full_tooltip;
+		}
+		slice_tooltips_pending = false;
+	}
+
+	return slices[slice_index].tooltip;
+}
+
 void GFXPieChartTexture::_bind_methods() {
 	OV_BIND_METHOD(GFXPieChartTexture::clear);
 
@@ -142,6 +445,15 @@ void GFXPieChartTexture::_bind_methods() {
 	OV_BIND_METHOD(GFXPieChartTexture::get_gfx_pie_chart_name);
 
 	OV_BIND_METHOD(GFXPieChartTexture::set_slices_array, { "new_slices" });
+	OV_BIND_METHOD(
+		GFXPieChartTexture::set_slices_packed, { "identifiers", "colours", "weights", "start", "end" }, DEFVAL(0), DEFVAL(-1)
+	);
+
+	OV_BIND_METHOD(GFXPieChartTexture::set_shader_mode, { "enabled" });
+	OV_BIND_METHOD(GFXPieChartTexture::is_shader_mode);
+	OV_BIND_METHOD(GFXPieChartTexture::get_shader_material);
+	OV_BIND_METHOD(GFXPieChartTexture::apply_shader_instance_parameters, { "canvas_item" });
+	OV_BIND_SMETHOD(get_shader_code);
 }
 
 GFXPieChartTexture::GFXPieChartTexture() {}
@@ -157,9 +469,14 @@ Ref<GFXPieChartTexture> GFXPieChartTexture::make_gfx_pie_chart_texture(GFX::PieC
 void GFXPieChartTexture::clear() {
 	gfx_pie_chart = nullptr;
 	slices.clear();
+	slice_ends.clear();
 	total_weight = 0.0f;
 
-	pie_chart_image.unref();
+	pie_chart_texture.unref();
+	pie_chart_key = {};
+
+	set_atlas(nullptr);
+	set_region({});
 }
 
 Error GFXPieChartTexture::set_gfx_pie_chart(GFX::PieChart const* new_gfx_pie_chart) {
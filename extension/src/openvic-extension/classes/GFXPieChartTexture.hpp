@@ -1,9 +1,16 @@
 #pragma once
 
 #include <functional>
+#include <span>
 #include <type_traits>
 
+#include <godot_cpp/classes/atlas_texture.hpp>
+#include <godot_cpp/classes/canvas_item.hpp>
 #include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
 
 #include <openvic-simulation/interface/GFXSprite.hpp>
 #include <openvic-simulation/types/Colour.hpp>
@@ -11,6 +18,7 @@
 #include <openvic-simulation/utility/Logger.hpp>
 
 #include "openvic-extension/core/Convert.hpp"
+#include "openvic-extension/singletons/AssetManager.hpp"
 #include "openvic-extension/utility/MapHelpers.hpp"
 #include "openvic-simulation/core/template/Concepts.hpp"
 
@@ -35,8 +43,8 @@ namespace OpenVic {
 		&& IsPieChartKey<map_key_t<MapType>>
 		&& IsPieChartValue<map_value_t<MapType>>;
 
-	class GFXPieChartTexture : public godot::ImageTexture {
-		GDCLASS(GFXPieChartTexture, godot::ImageTexture)
+	class GFXPieChartTexture : public godot::AtlasTexture {
+		GDCLASS(GFXPieChartTexture, godot::AtlasTexture)
 
 	public:
 		using godot_pie_chart_data_t = godot::TypedArray<godot::Dictionary>;
@@ -50,14 +58,46 @@ namespace OpenVic {
 	private:
 		GFX::PieChart const* PROPERTY(gfx_pie_chart, nullptr);
 		std::vector<slice_t> slices;
+		/* Cumulative slice weights as fractions of total_weight, i.e. the angle (as a fraction of a full rotation) at
+		 * which each slice ends, allowing the slice at a given angle to be found with a binary search. */
+		std::vector<float> slice_ends;
 		float PROPERTY(total_weight, 0.0f);
-		godot::Ref<godot::Image> pie_chart_image;
+		/* Set by set_slices_packed, whose slices have no tooltips until they are first requested with get_slice_tooltip. */
+		bool slice_tooltips_pending = false;
+		/* The atlas drawn by this texture, shared with every other pie chart showing the same slices at the same radius,
+		 * so must not be modified. */
+		godot::Ref<godot::ImageTexture> pie_chart_texture;
+		/* Identifies the slices drawn into pie_chart_texture, so unchanged slices don't need redrawing or reuploading.
+		 * Has an empty slice signature when pie_chart_texture was left blank for shader mode. */
+		PieChartCache::key_t pie_chart_key;
+
+		/* In shader mode slices are passed as instance uniforms, of which a shader may only have 16, so they are packed
+		 * four RGBA8 colours or eight 16-bit fixed point slice ends to a uniform. Pie charts with more slices than fit
+		 * are drawn on the CPU. */
+		static constexpr size_t SHADER_COLOURS_PER_UNIFORM = 4;
+		static constexpr size_t SHADER_ENDS_PER_UNIFORM = 8;
+		static constexpr size_t MAX_SHADER_SLICES = 32;
+		static constexpr size_t SHADER_COLOUR_UNIFORM_COUNT = MAX_SHADER_SLICES / SHADER_COLOURS_PER_UNIFORM;
+		static constexpr size_t SHADER_END_UNIFORM_COUNT = MAX_SHADER_SLICES / SHADER_ENDS_PER_UNIFORM;
+		/* Only set in shader mode, in which slices are drawn by this material rather than into pie_chart_texture. The
+		 * material is shared by every shader mode pie chart, via the AssetManager's pie chart cache. */
+		godot::Ref<godot::ShaderMaterial> shader_material;
+
+		/* Anti-clockwise angle of the centre of each pixel of a pie chart image with the given radius, as a fraction of
+		 * a full rotation, or -1 for pixels outside the circle. Computed once per radius and shared by all pie charts, and
+		 * safe to call from any thread. */
+		static std::span<const float> _get_angle_lookup(int32_t radius);
+
+		/* Index of the slice containing the given angle, as a fraction of a full rotation. slices must not be empty. */
+		size_t _get_slice_index(float angle) const;
 
 		static godot::StringName const& _slice_identifier_key();
 		static godot::StringName const& _slice_tooltip_key();
 		static godot::StringName const& _slice_colour_key();
 		static godot::StringName const& _slice_weight_key();
 
+		PieChartCache::key_t _make_pie_chart_key(int32_t radius) const;
+		godot::Ref<godot::Image> _draw_pie_chart_image(int32_t radius) const;
 		godot::Error _generate_pie_chart_image();
 
 	public:
@@ -187,11 +227,23 @@ namespace OpenVic {
 		 *  - weight: float */
 		godot::Error set_slices_array(godot_pie_chart_data_t const& new_slices);
 
+		/* Set slices given packed arrays of each slice's identifier (a localisation key), colour and weight, avoiding a
+		 * Dictionary per slice. Only the slices from start up to end are used (end -1 meaning the end of the arrays), so
+		 * the arrays can be shared by many pie charts. Slice tooltips are generated from the identifiers and weights when
+		 * first requested. */
+		godot::Error set_slices_packed(
+			godot::PackedStringArray const& identifiers, godot::PackedColorArray const& colours,
+			godot::PackedFloat32Array const& weights, int64_t start = 0, int64_t end = -1
+		);
+
+		/* Return the tooltip of a slice returned by get_slice, generating it first if slices were set with
+		 * set_slices_packed. The tooltip lists every slice's percentage, starting with the given slice. */
+		godot::String const& get_slice_tooltip(slice_t const& slice);
+
 		/* Create a GFXPieChartTexture using the specified GFX::PieChart. Returns nullptr if gfx_pie_chart fails. */
 		static godot::Ref<GFXPieChartTexture> make_gfx_pie_chart_texture(GFX::PieChart const* gfx_pie_chart);
 
-		/* Reset gfx_pie_chart, flag_country and flag_type to nullptr/an empty string, and unreference all images.
-		 * This does not affect the godot::ImageTexture, which cannot be reset to a null or empty image. */
+		/* Reset gfx_pie_chart to nullptr, remove all slices and unreference the shared pie chart texture. */
 		void clear();
 
 		/* Set the GFX::PieChart and regenerate the pie chart image. */
@@ -202,5 +254,23 @@ namespace OpenVic {
 
 		/* Return the name of the GFX::PieChart, or an empty String if it's null. */
 		godot::String get_gfx_pie_chart_name() const;
+
+		/* Enable or disable shader mode. In shader mode the slices are drawn at draw time by the material returned by
+		 * get_shader_material, which must be set on whatever draws this texture along with the parameters set by
+		 * apply_shader_instance_parameters. Changing the slices then only costs an instance parameter update rather than
+		 * regenerating and uploading the image, and every pie chart shares one material so can still be batched
+		 * together. The changed signal is emitted whenever the instance parameters need reapplying. Pie charts with
+		 * more than MAX_SHADER_SLICES slices are still drawn into the image, which the material then draws unchanged. */
+		godot::Error set_shader_mode(bool enabled);
+		bool is_shader_mode() const;
+
+		/* Return the material to draw this texture with in shader mode, or nullptr if shader mode is disabled. */
+		godot::Ref<godot::ShaderMaterial> get_shader_material() const;
+
+		/* Set the slices' per-instance shader parameters on the canvas item drawing this texture in shader mode. */
+		void apply_shader_instance_parameters(godot::CanvasItem* canvas_item) const;
+
+		/* Source code for the canvas item shader used in shader mode. */
+		static godot::String const& get_shader_code();
 	};
 }
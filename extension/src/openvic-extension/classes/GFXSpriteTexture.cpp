@@ -43,6 +43,7 @@ Ref<GFXSpriteTexture> GFXSpriteTexture::make_gfx_sprite_texture(
 void GFXSpriteTexture::clear() {
 	gfx_texture_sprite = nullptr;
 	_clear_button_states();
+	texture_rect = {};
 	icon_index = GFX::NO_FRAMES;
 	icon_count = GFX::NO_FRAMES;
 	cornered_tile_border_size = {};
@@ -59,16 +60,34 @@ Error GFXSpriteTexture::set_gfx_texture_sprite(GFX::TextureSprite const* new_gfx
 
 		const StringName texture_file = convert_to<String>(new_gfx_texture_sprite->get_texture_file());
 
-		/* Needed for GFXButtonStateTexture, AssetManager::get_texture will re-use this image from its internal cache. */
-		const Ref<Image> image = asset_manager->get_image(texture_file);
-		ERR_FAIL_NULL_V_MSG(image, FAILED, Utilities::format("Failed to load image: %s", texture_file));
+		/* Small images are drawn from a shared atlas page, whose image also serves as the source for
+		 * GFXButtonStateTexture as it contains the sprite's image at texture_rect. */
+		const AssetManager::atlas_region_t atlas_region = asset_manager->get_atlas_region(texture_file);
 
-		const Ref<ImageTexture> texture = asset_manager->get_texture(texture_file);
-		ERR_FAIL_NULL_V_MSG(texture, FAILED, Utilities::format("Failed to load texture: %s", texture_file));
+		if (atlas_region.page_texture.is_valid()) {
+			button_image = atlas_region.page_image;
+			set_atlas(atlas_region.page_texture);
+			texture_rect = atlas_region.region;
+		} else {
+			/* Needed for GFXButtonStateTexture, AssetManager::get_texture will re-use this image from its internal cache. */
+			const Ref<Image> image = asset_manager->get_image(texture_file);
+			ERR_FAIL_NULL_V_MSG(image, FAILED, Utilities::format("Failed to load image: %s", texture_file));
+
+			const Ref<ImageTexture> texture = asset_manager->get_texture(texture_file);
+			ERR_FAIL_NULL_V_MSG(texture, FAILED, Utilities::format("Failed to load texture: %s", texture_file));
+
+			button_image = image;
+			set_atlas(texture);
+			texture_rect = { 0, 0, texture->get_width(), texture->get_height() };
+		}
+
+		/* Stops filtering from sampling neighbouring images when drawing from an atlas page. */
+		set_filter_clip(atlas_region.page_texture.is_valid());
+		/* Neither atlas page regions nor cached images are ever modified once loaded, so any other sprite textures
+		 * using the same image file can share button state textures with this one. */
+		button_image_key = texture_file;
 
-		button_image = image;
 		gfx_texture_sprite = new_gfx_texture_sprite;
-		set_atlas(texture);
 		icon_index = GFX::NO_FRAMES;
 
 		GFX::IconTextureSprite const* const icon_texture_sprite = gfx_texture_sprite->cast_to<GFX::IconTextureSprite>();
@@ -111,15 +130,15 @@ String GFXSpriteTexture::get_gfx_texture_sprite_name() const {
 }
 
 Error GFXSpriteTexture::set_icon_index(int32_t new_icon_index) {
-	const Ref<Texture2D> atlas_texture = get_atlas();
-	ERR_FAIL_NULL_V(atlas_texture, FAILED);
-	const Vector2 size = atlas_texture->get_size();
+	ERR_FAIL_NULL_V(get_atlas(), FAILED);
+	const Vector2 position = texture_rect.position;
+	const Vector2 size = texture_rect.size;
 	if (icon_count <= GFX::NO_FRAMES) {
 		if (new_icon_index > GFX::NO_FRAMES) {
 			UtilityFunctions::push_warning("Invalid icon index ", new_icon_index, " for texture with no frames!");
 		}
 		icon_index = GFX::NO_FRAMES;
-		set_region({ {}, size });
+		set_region({ position, size });
 	} else {
 		if (GFX::NO_FRAMES < new_icon_index && new_icon_index <= icon_count) {
 			icon_index = new_icon_index;
@@ -131,7 +150,7 @@ Error GFXSpriteTexture::set_icon_index(int32_t new_icon_index) {
 				);
 			}
 		}
-		set_region({ (icon_index - 1) * size.x / icon_count, 0, size.x / icon_count, size.y });
+		set_region({ position.x + (icon_index - 1) * size.x / icon_count, position.y, size.x / icon_count, size.y });
 	}
 	_update_button_states();
 	return OK;
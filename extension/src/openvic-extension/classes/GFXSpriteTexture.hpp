@@ -18,6 +18,10 @@ namespace OpenVic {
 		GFX::frame_t PROPERTY(icon_index, 0);
 		GFX::frame_t PROPERTY(icon_count, 0);
 
+		/* The area of the atlas texture containing gfx_texture_sprite's image, which is the whole texture unless the image
+		 * has been packed into a shared AssetManager atlas page. Icon frames are regions within this area. */
+		godot::Rect2i texture_rect;
+
 	protected:
 		static void _bind_methods();
 
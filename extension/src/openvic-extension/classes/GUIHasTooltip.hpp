@@ -14,7 +14,10 @@
  *  - add GUI_TOOLTIP_IMPLEMENTATIONS(CLASS) to the class' source file.
  *  - add GUI_TOOLTIP_BIND_METHODS(CLASS) to the class' _bind_methods implementation.
  *  - call _tooltip_notification from the class' _notification method.
- *  - initialise tooltip_active to false in the class' constructor. */
+ *  - initialise tooltip_active to false in the class' constructor.
+ * A tooltip ID from MenuSingleton::make_tooltip_id can be set instead of or alongside the tooltip string, in which case
+ * the tooltip's text is only generated when it is shown (see MenuSingleton::show_control_provided_tooltip), and is
+ * regenerated while shown whenever the gamestate or locale changes. */
 
 #define GUI_TOOLTIP_DEFINITIONS \
 	public: \
@@ -23,11 +26,14 @@
 		); \
 		void set_tooltip_string(godot::String const& new_tooltip_string); \
 		void set_tooltip_substitution_dict(godot::Dictionary const& new_tooltip_substitution_dict); \
+		void set_tooltip_id(int64_t new_tooltip_id); \
 		void clear_tooltip(); \
 	private: \
 		godot::String PROPERTY(tooltip_string); \
 		godot::Dictionary PROPERTY(tooltip_substitution_dict); \
+		int64_t PROPERTY(tooltip_id, 0); \
 		bool PROPERTY_CUSTOM_PREFIX(tooltip_active, is, false); \
+		bool _has_tooltip() const; \
 		void _tooltip_notification(int what); \
 		void _set_tooltip_active(bool new_tooltip_active); \
 		void _set_tooltip_visibility(bool visible);
@@ -43,7 +49,7 @@
 			tooltip_string = new_tooltip_string; \
 			tooltip_substitution_dict = new_tooltip_substitution_dict; \
 			if (tooltip_active) { \
-				_set_tooltip_visibility(!tooltip_string.is_empty()); \
+				_set_tooltip_visibility(_has_tooltip()); \
 			} \
 		} \
 	} \
@@ -54,7 +60,7 @@
 		if (tooltip_string != new_tooltip_string) { \
 			tooltip_string = new_tooltip_string; \
 			if (tooltip_active) { \
-				_set_tooltip_visibility(!tooltip_string.is_empty()); \
+				_set_tooltip_visibility(_has_tooltip()); \
 			} \
 		} \
 	} \
@@ -65,24 +71,48 @@
 		if (tooltip_substitution_dict != new_tooltip_substitution_dict) { \
 			tooltip_substitution_dict = new_tooltip_substitution_dict; \
 			if (tooltip_active) { \
-				_set_tooltip_visibility(!tooltip_string.is_empty()); \
+				_set_tooltip_visibility(_has_tooltip()); \
+			} \
+		} \
+	} \
+	void CLASS::set_tooltip_id(int64_t new_tooltip_id) { \
+		if (get_mouse_filter() == MOUSE_FILTER_IGNORE) { \
+			set_mouse_filter(MOUSE_FILTER_PASS); \
+		} \
+		if (tooltip_id != new_tooltip_id) { \
+			tooltip_id = new_tooltip_id; \
+			if (tooltip_active) { \
+				_set_tooltip_visibility(_has_tooltip()); \
 			} \
 		} \
 	} \
 	void CLASS::clear_tooltip() { \
+		const bool had_tooltip_id = tooltip_id != 0; \
+		tooltip_id = 0; \
 		set_tooltip_string_and_substitution_dict({}, {}); \
+		if (had_tooltip_id && tooltip_active) { \
+			_set_tooltip_visibility(false); \
+		} \
+	} \
+	bool CLASS::_has_tooltip() const { \
+		return !tooltip_string.is_empty() || tooltip_id != 0; \
 	} \
 	void CLASS::_tooltip_notification(int what) { \
 		if (what == NOTIFICATION_MOUSE_ENTER_SELF) { \
 			_set_tooltip_active(true); \
 		} else if (what == NOTIFICATION_MOUSE_EXIT_SELF) { \
 			_set_tooltip_active(false); \
+		} else if (what == NOTIFICATION_TRANSLATION_CHANGED && tooltip_id != 0) { \
+			/* Text generated for tooltip IDs is translated, so must be regenerated in the new locale. */ \
+			MenuSingleton* menu_singleton = MenuSingleton::get_singleton(); \
+			ERR_FAIL_NULL(menu_singleton); \
+			menu_singleton->clear_tooltip_cache(); \
 		} \
 	} \
 	void CLASS::_set_tooltip_active(bool new_tooltip_active) { \
 		if (tooltip_active != new_tooltip_active) { \
 			tooltip_active = new_tooltip_active; \
-			if (!tooltip_string.is_empty()) { \
+			if (_has_tooltip()) { \
 				_set_tooltip_visibility(tooltip_active); \
 			} \
 		} \
@@ -90,10 +120,12 @@
 	void CLASS::_set_tooltip_visibility(bool visible) { \
 		MenuSingleton* menu_singleton = MenuSingleton::get_singleton(); \
 		ERR_FAIL_NULL(menu_singleton); \
-		if (visible) { \
-			menu_singleton->show_control_tooltip(tooltip_string, tooltip_substitution_dict, this); \
-		} else { \
+		if (!visible) { \
 			menu_singleton->hide_tooltip(); \
+		} else if (tooltip_id != 0) { \
+			menu_singleton->show_control_provided_tooltip(tooltip_id, tooltip_string, tooltip_substitution_dict, this); \
+		} else { \
+			menu_singleton->show_control_tooltip(tooltip_string, tooltip_substitution_dict, this); \
 		} \
 	}
 
@@ -105,6 +137,8 @@
 	OV_BIND_METHOD( \
 		CLASS::set_tooltip_string_and_substitution_dict, { "new_tooltip_string", "new_tooltip_substitution_dict" } \
 	); \
+	OV_BIND_METHOD(CLASS::get_tooltip_id); \
+	OV_BIND_METHOD(CLASS::set_tooltip_id, { "new_tooltip_id" }); \
 	OV_BIND_METHOD(CLASS::clear_tooltip); \
 	OV_BIND_METHOD(CLASS::is_tooltip_active); \
 	ADD_PROPERTY( \
@@ -115,4 +149,5 @@
 		PropertyInfo(Variant::DICTIONARY, "tooltip_substitution_dict"), \
 		"set_tooltip_substitution_dict", "get_tooltip_substitution_dict" \
 	); \
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "tooltip_id"), "set_tooltip_id", "get_tooltip_id"); \
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "tooltip_active"), "", "is_tooltip_active");
@@ -1,8 +1,10 @@
 #include "GUILabel.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <godot_cpp/classes/font_file.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/style_box_texture.hpp>
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/variant/node_path.hpp>
@@ -23,11 +25,10 @@ using namespace OpenVic;
 using namespace godot;
 using namespace OpenVic::Utilities::literals;
 
-GUILabel::string_segment_t::string_segment_t(String&& new_text, Color const& new_colour, real_t new_width)
-	: text { std::move(new_text) }, colour { new_colour }, width { new_width } {}
-
-GUILabel::string_segment_t::string_segment_t(String const& new_text, Color const& new_colour, real_t new_width)
-	: text { new_text }, colour { new_colour }, width { new_width } {}
+GUILabel::string_segment_t::string_segment_t(
+	String&& new_text, Color const& new_colour, Ref<TextLine> const& new_shaped_text
+) : text { std::move(new_text) }, colour { new_colour }, shaped_text { new_shaped_text },
+	width { new_shaped_text.is_valid() ? new_shaped_text->get_size().width : 0.0_real } {}
 
 static constexpr int32_t DEFAULT_FONT_SIZE = 16;
 static const Vector2 FLAG_DRAW_DIMS { 23.0_real, 11.0_real };
@@ -55,6 +56,23 @@ String const& GUILabel::get_flag_marker() {
 	return FLAG_MARKER;
 }
 
+Dictionary GUILabel::get_relayout_stats() {
+	static const StringName performed_key = "performed";
+	static const StringName skipped_key = "skipped";
+
+	Dictionary ret;
+
+	ret[performed_key] = static_cast<int64_t>(relayouts_performed);
+	ret[skipped_key] = static_cast<int64_t>(relayouts_skipped);
+
+	return ret;
+}
+
+void GUILabel::reset_relayout_stats() {
+	relayouts_performed = 0;
+	relayouts_skipped = 0;
+}
+
 void GUILabel::set_text_and_tooltip(
 	GUINode const& parent,
 	godot::NodePath const& path,
@@ -80,6 +98,8 @@ void GUILabel::_bind_methods() {
 	OV_BIND_SMETHOD(get_currency_marker);
 	OV_BIND_SMETHOD(get_substitution_marker);
 	OV_BIND_SMETHOD(get_flag_marker);
+	OV_BIND_SMETHOD(get_relayout_stats);
+	OV_BIND_SMETHOD(reset_relayout_stats);
 
 	OV_BIND_METHOD(GUILabel::clear);
 	OV_BIND_METHOD(GUILabel::get_gui_text_name);
@@ -192,16 +212,33 @@ void GUILabel::_notification(int what) {
 
 			for (segment_t const& segment : line.segments) {
 				if (string_segment_t const* string_segment = std::get_if<string_segment_t>(&segment)) {
-					font->draw_string(
-						ci, position, string_segment->text, HORIZONTAL_ALIGNMENT_LEFT, -1, font_size,
-						string_segment->colour
-					);
+					if (string_segment->shaped_text.is_valid()) {
+						// Offset from the baseline to the top of the text, as done by Font::draw_string
+						string_segment->shaped_text->draw(
+							ci, position - Vector2 { 0.0_real, string_segment->shaped_text->get_line_ascent() },
+							string_segment->colour
+						);
+					}
 
 					position.x += string_segment->width;
 				} else if (flag_segment_t const* flag_segment = std::get_if<flag_segment_t>(&segment)) {
-					(*flag_segment)->draw_rect(ci, Rect2 {
-						position - Vector2 { 1.0_real, ascent - 4.0_real }, FLAG_DRAW_DIMS
-					}, false);
+					const Vector2 flag_position = position - Vector2 { 1.0_real, ascent - 4.0_real };
+					Rect2 const& uv_rect = flag_segment->uv_rect;
+					const int32_t first_index = flag_points.size();
+
+					flag_points.push_back(flag_position);
+					flag_points.push_back(flag_position + Vector2 { FLAG_DRAW_DIMS.width, 0.0_real });
+					flag_points.push_back(flag_position + FLAG_DRAW_DIMS);
+					flag_points.push_back(flag_position + Vector2 { 0.0_real, FLAG_DRAW_DIMS.height });
+
+					flag_uvs.push_back(uv_rect.position);
+					flag_uvs.push_back(uv_rect.position + Vector2 { uv_rect.size.width, 0.0_real });
+					flag_uvs.push_back(uv_rect.get_end());
+					flag_uvs.push_back(uv_rect.position + Vector2 { 0.0_real, uv_rect.size.height });
+
+					for (const int32_t corner : { 0, 1, 2, 0, 2, 3 }) {
+						flag_indices.push_back(first_index + corner);
+					}
 
 					position.x += FLAG_SEGMENT_WIDTH;
 				} else if (currency_texture.is_valid()) {
@@ -218,6 +255,26 @@ void GUILabel::_notification(int what) {
 			position.y += descent;
 		}
 
+		if (!flag_indices.is_empty()) {
+			const Ref<ImageTexture> flag_sheet_texture = GameSingleton::get_singleton()->get_flag_sheet_texture();
+
+			if (flag_sheet_texture.is_valid()) {
+				// A single colour applies to every vertex
+				static const PackedColorArray flag_colours = []() -> PackedColorArray {
+					PackedColorArray colours;
+					colours.push_back(Color { 1.0f, 1.0f, 1.0f });
+					return colours;
+				}();
+
+				RenderingServer::get_singleton()->canvas_item_add_triangle_array(
+					ci, flag_indices, flag_points, flag_colours, flag_uvs, {}, {}, flag_sheet_texture->get_rid()
+				);
+			}
+
+			flag_points.clear();
+			flag_uvs.clear();
+			flag_indices.clear();
+		}
 	} break;
 	}
 }
@@ -229,6 +286,7 @@ void GUILabel::clear() {
 
 	text = String {};
 	substitution_dict.clear();
+	substitution_dict_hash = substitution_dict.hash();
 	horizontal_alignment = HORIZONTAL_ALIGNMENT_LEFT;
 	max_size = {};
 	border_size = {};
@@ -245,6 +303,8 @@ void GUILabel::clear() {
 	lines.clear();
 
 	line_update_queued = false;
+	line_layout_changed = false;
+	substituted_text = String {};
 
 	queue_redraw();
 }
@@ -321,10 +381,12 @@ Error GUILabel::set_gui_text(GUI::Text const* new_gui_text, GFX::Font::colour_co
 
 void GUILabel::force_update_lines() {
 	line_update_queued = true;
+	line_layout_changed = true;
 	_update_lines();
 }
 
 void GUILabel::set_text(String const& new_text) {
+	// Comparing directly is cheaper than hashing, as it stops at the first difference (or immediately if lengths differ)
 	if (text != new_text) {
 		text = new_text;
 
@@ -336,21 +398,35 @@ void GUILabel::add_substitution(String const& key, String const& value) {
 	Variant& existing_value = substitution_dict[key];
 	if (existing_value != value) {
 		existing_value = value;
+		substitution_dict_hash = substitution_dict.hash();
 
-		_queue_line_update();
+		_queue_substitution_update();
 	}
 }
 
 void GUILabel::set_substitution_dict(Dictionary const& new_substitution_dict) {
+	/* Different hashes rule out the dictionaries being equal without comparing every entry, but equal hashes still
+	 * need confirming. The stored hash also catches the same dictionary having been modified in place since it was set. */
+	const uint32_t new_substitution_dict_hash = new_substitution_dict.hash();
+	const bool changed =
+		substitution_dict_hash != new_substitution_dict_hash || substitution_dict != new_substitution_dict;
+
 	substitution_dict = new_substitution_dict;
-	_queue_line_update();
+	substitution_dict_hash = new_substitution_dict_hash;
+
+	if (changed) {
+		_queue_substitution_update();
+	} else {
+		relayouts_skipped++;
+	}
 }
 
 void GUILabel::clear_substitutions() {
 	if (!substitution_dict.is_empty()) {
 		substitution_dict.clear();
+		substitution_dict_hash = substitution_dict.hash();
 
-		_queue_line_update();
+		_queue_substitution_update();
 	}
 }
 
@@ -476,6 +552,14 @@ real_t GUILabel::get_string_width(String const& string) const {
 	return font->get_string_size(string, HORIZONTAL_ALIGNMENT_LEFT, -1, font_size).width;
 }
 
+GUILabel::string_segment_t GUILabel::make_string_segment(String&& string, Color const& colour) const {
+	AssetManager* asset_manager = AssetManager::get_singleton();
+	ERR_FAIL_NULL_V(asset_manager, (string_segment_t { std::move(string), colour, nullptr }));
+
+	Ref<TextLine> shaped_text = asset_manager->get_shaped_text_cache().get_shaped_text(font, font_size, string);
+	return { std::move(string), colour, shaped_text };
+}
+
 real_t GUILabel::get_segment_width(segment_t const& segment) const {
 	if (string_segment_t const* string_segment = std::get_if<string_segment_t>(&segment)) {
 		return string_segment->width;
@@ -489,6 +573,12 @@ real_t GUILabel::get_segment_width(segment_t const& segment) const {
 }
 
 void GUILabel::_queue_line_update() {
+	line_layout_changed = true;
+
+	_queue_substitution_update();
+}
+
+void GUILabel::_queue_substitution_update() {
 	if (!line_update_queued) {
 		line_update_queued = true;
 
@@ -502,52 +592,74 @@ void GUILabel::_update_lines() {
 	}
 
 	line_update_queued = false;
-	lines.clear();
 
 	if (text.is_empty() || font.is_null()) {
+		line_layout_changed = false;
+		substituted_text = String {};
+		lines.clear();
 		queue_redraw();
 		return;
 	}
 
 	String const& base_text = is_auto_translating() ? tr(text) : text;
 
-	String const& substituted_text = generate_substituted_text(base_text);
+	String new_substituted_text = generate_substituted_text(base_text);
+
+	// Substitution values often change to what they were before or only affect text which isn't displayed
+	if (!line_layout_changed && new_substituted_text == substituted_text) {
+		relayouts_skipped++;
+		return;
+	}
+
+	relayouts_performed++;
 
-	auto const& [display_text, colour_instructions] = generate_display_text_and_colour_instructions(substituted_text);
+	line_layout_changed = false;
+	substituted_text = std::move(new_substituted_text);
+	lines.clear();
 
-	std::vector<line_t> unwrapped_lines = generate_lines_and_segments(display_text, colour_instructions);
+	generate_unwrapped_lines(substituted_text);
 
 	lines = wrap_lines(unwrapped_lines);
+	unwrapped_lines.clear();
 
 	adjust_to_content_size();
 
 	queue_redraw();
 }
 
-String GUILabel::generate_substituted_text(String const& base_text) const {
-	String result;
-	int64_t start_pos = 0;
-	int64_t marker_start_pos;
+String GUILabel::generate_substituted_text(String const& base_text) {
+	const char32_t substitution_marker = get_substitution_marker()[0];
 
-	while ((marker_start_pos = base_text.find(get_substitution_marker(), start_pos)) != -1) {
-		result += base_text.substr(start_pos, marker_start_pos - start_pos);
+	if (base_text.find(get_substitution_marker()) == -1) {
+		return base_text;
+	}
 
-		int64_t marker_end_pos = base_text.find(
-			get_substitution_marker(), marker_start_pos + get_substitution_marker().length()
-		);
-		if (marker_end_pos == -1) {
-			marker_end_pos = base_text.length();
+	text_buffer.clear();
+
+	char32_t const* chars = base_text.ptr();
+	const int64_t length = base_text.length();
+
+	int64_t pos = 0;
+
+	while (pos < length) {
+		if (chars[pos] != substitution_marker) {
+			text_buffer.push_back(chars[pos++]);
+			continue;
 		}
 
-		String key = base_text.substr(
-			marker_start_pos + get_substitution_marker().length(),
-			marker_end_pos - marker_start_pos - get_substitution_marker().length()
-		);
+		const int64_t key_start = pos + 1;
+		int64_t key_end = key_start;
+
+		while (key_end < length && chars[key_end] != substitution_marker) {
+			++key_end;
+		}
+
+		String key = base_text.substr(key_start, key_end - key_start);
 		String value = substitution_dict.get(key, String {});
 
 		// Use the un-substituted key if no value is found or the value is empty
 		if (value.is_empty()) {
-			value = key;
+			value = std::move(key);
 		}
 
 		// Translate the value if auto-translating (even if it's the key after a failed substitution)
@@ -555,140 +667,123 @@ String GUILabel::generate_substituted_text(String const& base_text) const {
 			value = tr(value);
 		}
 
-		result += value;
-
-		start_pos = marker_end_pos + get_substitution_marker().length();
-	}
+		text_buffer.append(value.ptr(), value.length());
 
-	if (start_pos < base_text.length()) {
-		result += base_text.substr(start_pos);
+		pos = key_end + 1;
 	}
 
-	return result;
+	return String { text_buffer.c_str() };
 }
 
-std::pair<String, GUILabel::colour_instructions_t> GUILabel::generate_display_text_and_colour_instructions(
-	String const& substituted_text
-) const {
-	String result;
-	colour_instructions_t colour_instructions;
-	int64_t start_pos = 0;
-	int64_t marker_pos;
+void GUILabel::generate_unwrapped_lines(String const& substituted_text) {
+	static constexpr char RESET_COLOUR_CODE = '!';
+	static constexpr char32_t NEWLINE_MARKER = '\n';
+	static constexpr int64_t FLAG_IDENTIFIER_LENGTH = 3;
 
-	while ((marker_pos = substituted_text.find(get_colour_marker(), start_pos)) != -1) {
-		result += substituted_text.substr(start_pos, marker_pos - start_pos);
+	const char32_t colour_marker = get_colour_marker()[0];
+	const char32_t currency_marker = get_currency_marker()[0];
+	const char32_t flag_marker = get_flag_marker()[0];
 
-		if (marker_pos + get_colour_marker().length() < substituted_text.length()) {
-			const char32_t colour_code = substituted_text[marker_pos + get_colour_marker().length()];
+	const real_t currency_width = currency_texture.is_valid() ? currency_texture->get_width() : 0.0_real;
 
-			// Check that the colour code can be safely cast to a char
-			if (colour_code >> sizeof(char) * CHAR_BIT == 0) {
-				colour_instructions.emplace_back(result.length(), static_cast<char>(colour_code));
-			}
+	unwrapped_lines.clear();
+	unwrapped_lines.emplace_back();
+	text_buffer.clear();
 
-			start_pos = marker_pos + get_colour_marker().length() + 1;
-		} else {
-			return { std::move(result), std::move(colour_instructions) };
-		}
-	}
+	Color current_colour = default_colour;
 
-	result += substituted_text.substr(start_pos);
+	// Text is only split into a new segment when something interrupts it, not at colour codes which don't change the colour
+	const auto push_string_segment = [this, &current_colour]() -> void {
+		if (!text_buffer.empty()) {
+			line_t& line = unwrapped_lines.back();
+			string_segment_t const& segment = std::get<string_segment_t>(
+				line.segments.emplace_back(make_string_segment(String { text_buffer.c_str() }, current_colour))
+			);
+			line.width += segment.width;
+			text_buffer.clear();
+		}
+	};
 
-	return { std::move(result), std::move(colour_instructions) };
-}
+	char32_t const* chars = substituted_text.ptr();
+	const int64_t length = substituted_text.length();
 
-std::vector<GUILabel::line_t> GUILabel::generate_lines_and_segments(
-	String const& display_text, colour_instructions_t const& colour_instructions
-) const {
-	static constexpr char RESET_COLOUR_CODE = '!';
+	for (int64_t pos = 0; pos < length; ++pos) {
+		const char32_t character = chars[pos];
 
-	std::vector<line_t> unwrapped_lines;
-	colour_instructions_t::const_iterator colour_it = colour_instructions.begin();
-	Color current_colour = default_colour;
-	int64_t section_start = 0;
+		if (character == colour_marker) {
+			// A colour marker at the very end of the text has no colour code and is discarded
+			if (++pos >= length) {
+				break;
+			}
 
-	unwrapped_lines.emplace_back();
+			const char32_t colour_code = chars[pos];
 
-	for (int64_t idx = 0; idx < display_text.length(); ++idx) {
-		Color new_colour = current_colour;
-		for (; colour_it != colour_instructions.end(); colour_it++) {
-			if (idx != colour_it->first) {
-				break;
+			// Check that the colour code can be safely cast to a char
+			if (colour_code >> sizeof(char) * CHAR_BIT != 0) {
+				continue;
 			}
-			if (colour_it->second == RESET_COLOUR_CODE) {
+
+			Color new_colour = current_colour;
+			if (colour_code == RESET_COLOUR_CODE) {
 				new_colour = default_colour;
 			} else {
 				ERR_CONTINUE(colour_codes == nullptr);
-				const GFX::Font::colour_codes_t::const_iterator it = colour_codes->find(colour_it->second);
+				const GFX::Font::colour_codes_t::const_iterator it = colour_codes->find(static_cast<char>(colour_code));
 				if (it != colour_codes->end()) {
 					new_colour = convert_to<Color>(it->second);
 				}
 			}
-		}
 
-		if (current_colour != new_colour) {
-			if (section_start < idx) {
-				separate_lines(
-					display_text.substr(section_start, idx - section_start), current_colour, unwrapped_lines
-				);
-				section_start = idx;
+			if (current_colour != new_colour) {
+				push_string_segment();
+				current_colour = new_colour;
+			}
+		} else if (character == NEWLINE_MARKER) {
+			push_string_segment();
+			unwrapped_lines.emplace_back();
+		} else if (character == currency_marker) {
+			push_string_segment();
+			line_t& line = unwrapped_lines.back();
+			line.segments.push_back(currency_segment_t {});
+			line.width += currency_width;
+		} else if (character == flag_marker) {
+			push_string_segment();
+
+			// The identifier must be entirely on the current line, so it's cut short by a newline as well as the end of text
+			const int64_t identifier_start = pos + 1;
+			const int64_t identifier_limit = std::min(identifier_start + FLAG_IDENTIFIER_LENGTH, length);
+			int64_t identifier_end = identifier_start;
+			while (identifier_end < identifier_limit && chars[identifier_end] != NEWLINE_MARKER) {
+				++identifier_end;
 			}
-			current_colour = new_colour;
-		}
-	}
-
-	if (section_start < display_text.length()) {
-		separate_lines(display_text.substr(section_start), current_colour, unwrapped_lines);
-	}
-
-	return unwrapped_lines;
-}
-
-void GUILabel::separate_lines(
-	String const& string, Color const& colour, std::vector<line_t>& unwrapped_lines
-) const {
-	static const String NEWLINE_MARKER = "\n";
-
-	int64_t start_pos = 0;
-	int64_t newline_pos;
-
-	while ((newline_pos = string.find(NEWLINE_MARKER, start_pos)) != -1) {
-		if (start_pos < newline_pos) {
-			separate_currency_segments(string.substr(start_pos, newline_pos - start_pos), colour, unwrapped_lines.back());
-		}
-
-		unwrapped_lines.emplace_back();
-
-		start_pos = newline_pos + NEWLINE_MARKER.length();
-	}
 
-	if (start_pos < string.length()) {
-		separate_currency_segments(string.substr(start_pos), colour, unwrapped_lines.back());
-	}
-}
+			if (identifier_end - identifier_start < FLAG_IDENTIFIER_LENGTH) {
+				UtilityFunctions::push_warning(
+					"Incomplete flag identifier \"",
+					substituted_text.substr(identifier_start, identifier_end - identifier_start),
+					"\" at end of line in GUILabel text \"", substituted_text, "\" - discarding!"
+				);
+				// Resume at the newline (if there is one), so the following lines are still generated
+				pos = identifier_end - 1;
+				continue;
+			}
 
-void GUILabel::separate_currency_segments(
-	String const& string, Color const& colour, line_t& line
-) const {
-	int64_t start_pos = 0;
-	int64_t marker_pos;
+			const flag_segment_t flag_segment =
+				make_flag_segment(substituted_text.substr(identifier_start, FLAG_IDENTIFIER_LENGTH));
 
-	const real_t currency_width = currency_texture.is_valid() ? currency_texture->get_width() : 0.0_real;
+			if (flag_segment.uv_rect.has_area()) {
+				line_t& line = unwrapped_lines.back();
+				line.segments.push_back(flag_segment);
+				line.width += FLAG_SEGMENT_WIDTH;
+			}
 
-	while ((marker_pos = string.find(get_currency_marker(), start_pos)) != -1) {
-		if (start_pos < marker_pos) {
-			separate_flag_segments(string.substr(start_pos, marker_pos - start_pos), colour, line);
+			pos += FLAG_IDENTIFIER_LENGTH;
+		} else {
+			text_buffer.push_back(character);
 		}
-
-		line.segments.push_back(currency_segment_t {});
-		line.width += currency_width;
-
-		start_pos = marker_pos + get_currency_marker().length();
 	}
 
-	if (start_pos < string.length()) {
-		separate_flag_segments(string.substr(start_pos), colour, line);
-	}
+	push_string_segment();
 }
 
 GUILabel::flag_segment_t GUILabel::make_flag_segment(String const& identifier) {
@@ -735,59 +830,12 @@ GUILabel::flag_segment_t GUILabel::make_flag_segment(String const& identifier) {
 	const Rect2 flag_image_rect = game_singleton.get_flag_sheet_rect(country_index.value(), flag_type);
 	ERR_FAIL_COND_V(!flag_image_rect.has_area(), {});
 
-	flag_segment_t flag_segment;
-	flag_segment.instantiate();
-	ERR_FAIL_NULL_V(flag_segment, {});
-
-	flag_segment->set_region(flag_image_rect);
-	flag_segment->set_atlas(game_singleton.get_flag_sheet_texture());
-
-	return flag_segment;
-}
-
-void GUILabel::separate_flag_segments(
-	String const& string, Color const& colour, line_t& line
-) const {
-	const auto push_string_segment = [this, &string, &colour, &line](int64_t start, int64_t end) -> void {
-		String substring = string.substr(start, end - start);
-		const real_t width = get_string_width(substring);
-		line.segments.emplace_back(string_segment_t { std::move(substring), colour, width });
-		line.width += width;
-	};
-
-	int64_t start_pos = 0;
-	int64_t marker_pos;
-
-	static const int64_t FLAG_IDENTIFIER_LENGTH = 3;
+	const Ref<ImageTexture> flag_sheet_texture = game_singleton.get_flag_sheet_texture();
+	ERR_FAIL_NULL_V(flag_sheet_texture, {});
 
-	while ((marker_pos = string.find(get_flag_marker(), start_pos)) != -1) {
-		if (start_pos < marker_pos) {
-			push_string_segment(start_pos, marker_pos);
-		}
-
-		marker_pos += get_flag_marker().length();
-
-		start_pos = marker_pos + FLAG_IDENTIFIER_LENGTH;
-
-		if (start_pos >= string.length()) {
-			UtilityFunctions::push_warning(
-				"Incomplete flag identifier \"", string.substr(marker_pos), "\" at end of line \"", string,
-				"\" in GUILabel text - discarding!"
-			);
-			return;
-		}
+	const Vector2 flag_sheet_size = flag_sheet_texture->get_size();
 
-		const flag_segment_t flag_segment = make_flag_segment(string.substr(marker_pos, FLAG_IDENTIFIER_LENGTH));
-
-		if (flag_segment.is_valid()) {
-			line.segments.push_back(flag_segment);
-			line.width += FLAG_SEGMENT_WIDTH;
-		}
-	}
-
-	if (start_pos < string.length()) {
-		push_string_segment(start_pos, string.length());
-	}
+	return { { flag_image_rect.position / flag_sheet_size, flag_image_rect.size / flag_sheet_size } };
 }
 
 std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrapped_lines) const {
@@ -822,7 +870,6 @@ std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrappe
 
 						if (current_line->width + whole_segment_width > max_content_size.width) {
 							String new_segment_string;
-							real_t new_segment_width = 0.0_real;
 
 							int64_t last_marker_pos = 0;
 							int64_t marker_pos;
@@ -832,7 +879,6 @@ std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrappe
 								const real_t width = get_string_width(substring);
 								if (current_line->width + width <= max_content_size.width) {
 									new_segment_string = std::move(substring);
-									new_segment_width = width;
 									last_marker_pos = marker_pos + SPACE_MARKER.length();
 								} else {
 									break;
@@ -841,10 +887,10 @@ std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrappe
 
 							if (last_marker_pos != 0 || !current_line->segments.empty()) {
 								if (!new_segment_string.is_empty()) {
-									current_line->segments.emplace_back(string_segment_t {
-										std::move(new_segment_string), string_segment->colour, new_segment_width
-									});
-									current_line->width += new_segment_width;
+									// Line widths are summed from the segments' shaped text, as used when drawing
+									current_line->width += std::get<string_segment_t>(current_line->segments.emplace_back(
+										make_string_segment(std::move(new_segment_string), string_segment->colour)
+									)).width;
 								}
 
 								current_line = &wrapped_lines.emplace_back();
@@ -854,10 +900,9 @@ std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrappe
 								continue;
 							}
 						}
-						current_line->segments.emplace_back(string_segment_t {
-							std::move(whole_segment_string), string_segment->colour, whole_segment_width
-						});
-						current_line->width += whole_segment_width;
+						current_line->width += std::get<string_segment_t>(current_line->segments.emplace_back(
+							make_string_segment(std::move(whole_segment_string), string_segment->colour)
+						)).width;
 						break;
 					}
 
@@ -882,10 +927,13 @@ std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrappe
 		} while (is_over_max_height());
 
 		static const String ELLIPSIS = "...";
-		const real_t ellipsis_width = get_string_width(ELLIPSIS);
+		string_segment_t ellipsis_segment = make_string_segment(String { ELLIPSIS }, default_colour);
+		const real_t ellipsis_width = ellipsis_segment.width;
 
 		line_t& last_line = wrapped_lines.back();
 		Color last_colour = default_colour;
+		/* Shorter prefixes are only measured, so that just the final trimmed string is shaped and cached. */
+		bool last_segment_trimmed = false;
 
 		while (last_line.segments.size() > 0 && last_line.width + ellipsis_width > max_content_size.width) {
 			if (string_segment_t* string_segment = std::get_if<string_segment_t>(&last_line.segments.back())) {
@@ -898,17 +946,28 @@ std::vector<GUILabel::line_t> GUILabel::wrap_lines(std::vector<line_t>& unwrappe
 					last_line.width -= string_segment->width;
 					string_segment->width = get_string_width(last_string);
 					last_line.width += string_segment->width;
+					last_segment_trimmed = true;
 				} else {
 					last_line.width -= string_segment->width;
 					last_line.segments.pop_back();
+					last_segment_trimmed = false;
 				}
 			} else {
 				last_line.width -= currency_texture->get_width();
 				last_line.segments.pop_back();
+				last_segment_trimmed = false;
 			}
 		}
 
-		last_line.segments.push_back(string_segment_t { ELLIPSIS, last_colour, ellipsis_width });
+		if (last_segment_trimmed) {
+			string_segment_t& string_segment = std::get<string_segment_t>(last_line.segments.back());
+			last_line.width -= string_segment.width;
+			string_segment = make_string_segment(std::move(string_segment.text), string_segment.colour);
+			last_line.width += string_segment.width;
+		}
+
+		ellipsis_segment.colour = last_colour;
+		last_line.segments.push_back(std::move(ellipsis_segment));
 		last_line.width += ellipsis_width;
 	}
 
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <string>
+
 #include <godot_cpp/classes/atlas_texture.hpp>
 #include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/font.hpp>
 #include <godot_cpp/classes/font_file.hpp>
 #include <godot_cpp/classes/style_box_texture.hpp>
+#include <godot_cpp/classes/text_line.hpp>
 
 #include <openvic-simulation/interface/GUI.hpp>
 
@@ -26,12 +29,13 @@ namespace OpenVic {
 	private:
 		GUI_TOOLTIP_DEFINITIONS
 
-		using colour_instructions_t = std::vector<std::pair<int64_t, char>>;
-
 		GUI::Text const* PROPERTY(gui_text, nullptr);
 
 		godot::String PROPERTY(text);
 		godot::Dictionary PROPERTY(substitution_dict);
+		/* Content hash of substitution_dict, as callers often pass the same Dictionary again after modifying it, so a
+		 * comparison with the stored reference could miss changes. */
+		uint32_t substitution_dict_hash = godot::Dictionary {}.hash();
 		godot::HorizontalAlignment PROPERTY(horizontal_alignment, godot::HORIZONTAL_ALIGNMENT_LEFT);
 		godot::Size2 PROPERTY(max_size); // Actual max size is max_size - 2 * border_size
 		godot::Size2 PROPERTY(border_size); // The padding between the Nodes bounding box and the text within it
@@ -49,14 +53,22 @@ namespace OpenVic {
 		struct string_segment_t {
 			godot::String text;
 			godot::Color colour;
+			/* Shared via AssetManager's shaped text cache, so must not be modified. */
+			godot::Ref<godot::TextLine> shaped_text;
 			real_t width;
 
-			string_segment_t(godot::String&& new_text, godot::Color const& new_colour, real_t new_width);
-			string_segment_t(godot::String const& new_text, godot::Color const& new_colour, real_t new_width);
+			string_segment_t(
+				godot::String&& new_text, godot::Color const& new_colour, godot::Ref<godot::TextLine> const& new_shaped_text
+			);
 			string_segment_t(string_segment_t&&) = default;
+			string_segment_t& operator=(string_segment_t&&) = default;
 		};
 		using currency_segment_t = std::monostate;
-		using flag_segment_t = godot::Ref<godot::AtlasTexture>;
+		/* Flags are drawn straight from GameSingleton's flag sheet texture rather than via their own AtlasTextures. */
+		struct flag_segment_t {
+			/* Region of the flag sheet containing the flag, with coordinates as fractions of the sheet's size. */
+			godot::Rect2 uv_rect;
+		};
 		using segment_t = std::variant<string_segment_t, currency_segment_t, flag_segment_t>;
 		struct line_t {
 			std::vector<segment_t> segments;
@@ -65,7 +77,27 @@ namespace OpenVic {
 
 		std::vector<line_t> lines;
 
+		/* Reused between line updates to avoid reallocating: unwrapped_lines holds lines before wrapping, and
+		 * text_buffer the characters of the string being built while tokenizing text. */
+		std::vector<line_t> unwrapped_lines;
+		std::u32string text_buffer;
+
+		/* Flag quads are collected while drawing and submitted together in a single call, as they share a texture. */
+		godot::PackedVector2Array flag_points;
+		godot::PackedVector2Array flag_uvs;
+		godot::PackedInt32Array flag_indices;
+
+		/* Totals across all GUILabels of line updates which regenerated lines and of updates skipped because nothing
+		 * displayed had changed, either when an unchanged substitution dictionary was set or when the queued update ran.
+		 * Setting unchanged text or substitution values has never caused an update, so isn't counted as a skip. */
+		static inline uint64_t relayouts_performed = 0;
+		static inline uint64_t relayouts_skipped = 0;
+
 		bool line_update_queued = false;
+		/* Whether anything other than substitution values has changed since lines were last generated. If not, lines
+		 * are only regenerated if the substituted text differs from substituted_text. */
+		bool line_layout_changed = false;
+		godot::String substituted_text;
 
 	protected:
 		static void _bind_methods();
@@ -77,6 +109,9 @@ namespace OpenVic {
 		static godot::String const& get_currency_marker();
 		static godot::String const& get_substitution_marker();
 		static godot::String const& get_flag_marker();
+		/* Return a Dictionary with the number of performed and skipped line updates since the last reset. */
+		static godot::Dictionary get_relayout_stats();
+		static void reset_relayout_stats();
 		static void set_text_and_tooltip(
 			GUINode const& parent,
 			godot::NodePath const& path,
@@ -124,28 +159,19 @@ namespace OpenVic {
 	private:
 		void update_stylebox_border_size();
 		real_t get_string_width(godot::String const& string) const;
+		string_segment_t make_string_segment(godot::String&& string, godot::Color const& colour) const;
 		real_t get_segment_width(segment_t const& segment) const;
 
 		void _queue_line_update();
+		/* Queue a line update which is skipped if the substituted text hasn't changed. */
+		void _queue_substitution_update();
 		void _update_lines();
 
-		godot::String generate_substituted_text(godot::String const& base_text) const;
-		std::pair<godot::String, colour_instructions_t> generate_display_text_and_colour_instructions(
-			godot::String const& substituted_text
-		) const;
-		std::vector<line_t> generate_lines_and_segments(
-			godot::String const& display_text, colour_instructions_t const& colour_instructions
-		) const;
-		void separate_lines(
-			godot::String const& string, godot::Color const& colour, std::vector<line_t>& lines
-		) const;
-		void separate_currency_segments(
-			godot::String const& string, godot::Color const& colour, line_t& line
-		) const;
+		godot::String generate_substituted_text(godot::String const& base_text);
+		/* Split substituted text into unwrapped_lines in a single pass, applying and removing colour codes and
+		 * replacing currency and flag markers with their own segments. */
+		void generate_unwrapped_lines(godot::String const& substituted_text);
 		static flag_segment_t make_flag_segment(godot::String const& identifier);
-		void separate_flag_segments(
-			godot::String const& string, godot::Color const& colour, line_t& line
-		) const;
 		std::vector<line_t> wrap_lines(std::vector<line_t>& unwrapped_lines) const;
 		void adjust_to_content_size();
 	};
@@ -1,6 +1,6 @@
 #include "GUILineChart.hpp"
 
-#include <godot_cpp/classes/gradient.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/vector2i.hpp>
 
 #include "openvic-extension/core/Bind.hpp"
@@ -34,6 +34,35 @@ void GUILineChart::_bind_methods() {
 
 void GUILineChart::_notification(int what) {
 	_tooltip_notification(what);
+
+	if (what == NOTIFICATION_DRAW) {
+		if (line_count == 0) {
+			return;
+		}
+
+		RenderingServer* rendering_server = RenderingServer::get_singleton();
+		ERR_FAIL_NULL(rendering_server);
+
+		const RID canvas_item = get_canvas_item();
+		const float line_width =
+			gfx_line_chart != nullptr ? static_cast<float>(gfx_line_chart->get_linewidth()) : DEFAULT_LINE_WIDTH;
+
+		for (size_t index = 0; index < line_count; ++index) {
+			line_t const& line = lines[index];
+			rendering_server->canvas_item_add_polyline(canvas_item, line.points, line.colours, line_width);
+		}
+	}
+}
+
+GUILineChart::line_t& GUILineChart::_add_line(int64_t point_count) {
+	if (line_count >= lines.size()) {
+		lines.emplace_back();
+	}
+
+	line_t& line = lines[line_count++];
+	line.points.resize(point_count);
+
+	return line;
 }
 
 GUILineChart::GUILineChart() {
@@ -47,12 +76,9 @@ void GUILineChart::clear() {
 }
 
 void GUILineChart::clear_lines() {
-	int32_t child_index = get_child_count();
-
-	while (child_index > 0) {
-		Node* child = get_child(--child_index);
-		remove_child(child);
-		child->queue_free();
+	if (line_count > 0) {
+		line_count = 0;
+		queue_redraw();
 	}
 
 	point_count = 0;
@@ -74,6 +100,9 @@ Error GUILineChart::set_gfx_line_chart(GFX::LineChart const* new_gfx_line_chart)
 
 	set_custom_minimum_size(convert_to<godot::Vector2i>(gfx_line_chart->get_size()));
 
+	// The line width may have changed
+	queue_redraw();
+
 	return OK;
 }
 
@@ -107,20 +136,6 @@ Error GUILineChart::set_gradient_line(PackedFloat32Array const& line_values, flo
 
 	clear_lines();
 
-	Line2D* line = memnew(Line2D);
-	ERR_FAIL_NULL_V(line, FAILED);
-
-	if (gfx_line_chart != nullptr) {
-		line->set_width(static_cast<float>(gfx_line_chart->get_linewidth()));
-	}
-
-	Ref<Gradient> gradient;
-	gradient.instantiate();
-	ERR_FAIL_NULL_V(gradient, FAILED);
-
-	// Remove hardcoded (1, WHITE) point
-	gradient->remove_point(1);
-
 	// Calculate the height of the graph in value-space
 	for (int64_t index = 0; index < line_values.size(); ++index) {
 		const float abs_value = std::abs(line_values[index] - central_value);
@@ -139,47 +154,33 @@ Error GUILineChart::set_gradient_line(PackedFloat32Array const& line_values, flo
 		min_value_range *= 2.0f;
 	}
 
+	line_t& line = _add_line(line_values.size());
+	line.colours.resize(line_values.size());
+
+	Vector2* points = line.points.ptrw();
+	Color* colours = line.colours.ptrw();
+
 	const Vector2 size = get_size();
 
 	// Centre the graph vertically
-	line->set_position({ 0.0_real, size.height / 2.0_real });
+	const real_t offset_y = size.height / 2.0_real;
 
 	// Negative so height scale flips values (y increases as you go down with Godot's 2D coordinate system)
 	const Vector2 scale { size.width / (line_values.size() - 1), size.height / -min_value_range };
 
-	Vector2 last_point;
-	real_t distance = 0.0_real;
+	static const Color MAX_COLOUR { 0.0f, 1.0f, 0.0f };
+	static const Color MIN_COLOUR { 1.0f, 0.0f, 0.0f };
 
 	for (int64_t index = 0; index < line_values.size(); ++index) {
 		const float value = line_values[index] - central_value;
 
-		const Vector2 point { index * scale.x, value * scale.y };
-
-		line->add_point(point);
-
-		if (index > 0) {
-			distance += last_point.distance_to(point);
-		}
-
-		last_point = point;
-
-		static const Color MAX_COLOUR { 0.0f, 1.0f, 0.0f };
-		static const Color MIN_COLOUR { 1.0f, 0.0f, 0.0f };
-
-		gradient->add_point(distance, MIN_COLOUR.lerp(MAX_COLOUR, value / min_value_range + 0.5f));
-	}
-
-	// Remove hardcoded (0, BLACK) point (couldn't remove earlier as the gradient can't be empty)
-	gradient->remove_point(0);
+		points[index] = { index * scale.x, offset_y + value * scale.y };
 
-	// Rescale the gradient points to be in the range [0, 1]
-	for (int32_t index = 0; index < gradient->get_point_count(); ++index) {
-		gradient->set_offset(index, gradient->get_offset(index) / distance);
+		// Colours are interpolated between points, equivalent to a gradient with a point at each vertex
+		colours[index] = MIN_COLOUR.lerp(MAX_COLOUR, value / min_value_range + 0.5f);
 	}
 
-	line->set_gradient(gradient);
-
-	add_child(line);
+	queue_redraw();
 
 	return OK;
 }
@@ -196,14 +197,11 @@ Error GUILineChart::add_coloured_line(PackedFloat32Array const& line_values, Col
 		));
 	}
 
-	Line2D* line = memnew(Line2D);
-	ERR_FAIL_NULL_V(line, FAILED);
-
-	if (gfx_line_chart != nullptr) {
-		line->set_width(static_cast<float>(gfx_line_chart->get_linewidth()));
-	}
+	line_t& line = _add_line(line_values.size());
+	line.colours.resize(1);
+	line.colours.set(0, line_colour);
 
-	line->set_default_color(line_colour);
+	Vector2* points = line.points.ptrw();
 
 	const Vector2 size = get_size();
 
@@ -213,7 +211,7 @@ Error GUILineChart::add_coloured_line(PackedFloat32Array const& line_values, Col
 		float value = line_values[index];
 
 		// Negative so height scale flips values (y increases as you go down with Godot's 2D coordinate system)
-		line->add_point({ index * scale_x, -value });
+		points[index] = { index * scale_x, -value };
 
 		if (value < min_value) {
 			min_value = value;
@@ -222,7 +220,7 @@ Error GUILineChart::add_coloured_line(PackedFloat32Array const& line_values, Col
 		}
 	}
 
-	add_child(line);
+	queue_redraw();
 
 	return OK;
 }
@@ -238,19 +236,15 @@ void GUILineChart::scale_coloured_lines() {
 		scale_y = 1.0f;
 	}
 
-	const int32_t child_count = get_child_count();
+	for (size_t line_index = 0; line_index < line_count; ++line_index) {
+		PackedVector2Array& line_points = lines[line_index].points;
+		Vector2* points = line_points.ptrw();
 
-	for (int32_t line_index = 0; line_index < child_count; ++line_index) {
-		Line2D* line = Object::cast_to<Line2D>(get_child(line_index));
-		ERR_CONTINUE(line == nullptr);
-
-		for (int32_t point_index = 0; point_index < line->get_point_count(); ++point_index) {
-			Vector2 point = line->get_point_position(point_index);
-
-			point.y += translate_y;
-			point.y *= scale_y;
-
-			line->set_point_position(point_index, point);
+		for (int64_t point_index = 0; point_index < line_points.size(); ++point_index) {
+			points[point_index].y += translate_y;
+			points[point_index].y *= scale_y;
 		}
 	}
+
+	queue_redraw();
 }
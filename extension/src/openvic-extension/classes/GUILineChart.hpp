@@ -1,7 +1,10 @@
 #pragma once
 
+#include <vector>
+
 #include <godot_cpp/classes/control.hpp>
-#include <godot_cpp/classes/line2d.hpp>
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
 
 #include <openvic-simulation/interface/GFXSprite.hpp>
 #include "openvic-extension/classes/GUIHasTooltip.hpp"
@@ -14,6 +17,20 @@ namespace OpenVic {
 
 		GFX::LineChart const* gfx_line_chart = nullptr;
 
+		/* Lines are drawn directly onto this node's canvas item. Their buffers are kept when lines are cleared so that
+		 * redrawing a chart with the same number of points reuses them rather than reallocating. */
+		struct line_t {
+			godot::PackedVector2Array points;
+			/* Either one colour per point or a single colour for the whole line. */
+			godot::PackedColorArray colours;
+		};
+		std::vector<line_t> lines;
+		/* Number of entries at the start of lines which are in use. */
+		size_t line_count = 0;
+
+		/* Matches Line2D's default width, used if there is no GFX::LineChart. */
+		static constexpr float DEFAULT_LINE_WIDTH = 10.0f;
+
 		int32_t point_count = 0;
 		float PROPERTY(min_value, 0.0f);
 		float PROPERTY(max_value, 0.0f);
@@ -23,6 +40,10 @@ namespace OpenVic {
 
 		void _notification(int what);
 
+	private:
+		/* Returns an unused line whose point buffer is resized to point_count. */
+		line_t& _add_line(int64_t point_count);
+
 	public:
 		GUILineChart();
 
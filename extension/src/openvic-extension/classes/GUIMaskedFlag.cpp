@@ -1,6 +1,9 @@
 #include "GUIMaskedFlag.hpp"
 
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+
 #include "openvic-extension/core/Bind.hpp"
+#include "openvic-extension/utility/UITools.hpp"
 
 using namespace godot;
 using namespace OpenVic;
@@ -15,14 +18,38 @@ void GUIMaskedFlag::_bind_methods() {
 	OV_BIND_METHOD(GUIMaskedFlag::set_flag_country_name, { "flag_country_name" });
 	OV_BIND_METHOD(GUIMaskedFlag::get_flag_country_name);
 	OV_BIND_METHOD(GUIMaskedFlag::get_flag_type);
+
+	OV_BIND_METHOD(GUIMaskedFlag::set_shader_mode, { "new_shader_mode" });
+	OV_BIND_METHOD(GUIMaskedFlag::is_shader_mode);
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "shader_mode"), "set_shader_mode", "is_shader_mode");
+}
+
+Error GUIMaskedFlag::_apply_shader_mode() {
+	return UITools::apply_texture_shader_mode(*this, *gfx_masked_flag_texture.ptr(), shader_mode);
+}
+
+void GUIMaskedFlag::_on_texture_changed() {
+	if (shader_mode) {
+		_apply_shader_mode();
+	}
+}
+
+Error GUIMaskedFlag::_make_gfx_masked_flag_texture() {
+	static const StringName changed_signal = "changed";
+
+	gfx_masked_flag_texture.instantiate();
+	ERR_FAIL_NULL_V(gfx_masked_flag_texture, FAILED);
+	gfx_masked_flag_texture->connect(changed_signal, callable_mp(this, &GUIMaskedFlag::_on_texture_changed));
+	/* Applied before the masked flag is set, so the combined image is never needlessly generated on the CPU. */
+	return _apply_shader_mode();
 }
 
 Error GUIMaskedFlag::set_gfx_masked_flag(GFX::MaskedFlag const* gfx_masked_flag) {
 	const bool needs_setting = gfx_masked_flag_texture.is_null();
 
 	if (needs_setting) {
-		gfx_masked_flag_texture.instantiate();
-		ERR_FAIL_NULL_V(gfx_masked_flag_texture, FAILED);
+		ERR_FAIL_COND_V(_make_gfx_masked_flag_texture() != OK, FAILED);
 	}
 
 	const Error err = gfx_masked_flag_texture->set_gfx_masked_flag(gfx_masked_flag);
@@ -44,8 +71,7 @@ Error GUIMaskedFlag::set_gfx_masked_flag_name(String const& gfx_masked_flag_name
 	const bool needs_setting = gfx_masked_flag_texture.is_null();
 
 	if (needs_setting) {
-		gfx_masked_flag_texture.instantiate();
-		ERR_FAIL_NULL_V(gfx_masked_flag_texture, FAILED);
+		ERR_FAIL_COND_V(_make_gfx_masked_flag_texture() != OK, FAILED);
 	}
 
 	const Error err = gfx_masked_flag_texture->set_gfx_masked_flag_name(gfx_masked_flag_name);
@@ -86,3 +112,13 @@ String GUIMaskedFlag::get_flag_type() const {
 
 	return gfx_masked_flag_texture->get_flag_type();
 }
+
+Error GUIMaskedFlag::set_shader_mode(bool new_shader_mode) {
+	shader_mode = new_shader_mode;
+
+	if (gfx_masked_flag_texture.is_null()) {
+		return OK;
+	}
+
+	return _apply_shader_mode();
+}
@@ -9,6 +9,13 @@ namespace OpenVic {
 
 		godot::Ref<GFXMaskedFlagTexture> gfx_masked_flag_texture;
 
+		/* Whether the flag is composited at draw time by a shader, see GFXMaskedFlagTexture::set_shader_mode. */
+		bool PROPERTY_CUSTOM_PREFIX(shader_mode, is, false);
+
+		godot::Error _apply_shader_mode();
+		void _on_texture_changed();
+		godot::Error _make_gfx_masked_flag_texture();
+
 	protected:
 		static void _bind_methods();
 
@@ -30,5 +37,9 @@ namespace OpenVic {
 		godot::String get_flag_country_name() const;
 
 		godot::String get_flag_type() const;
+
+		/* Enable or disable shader mode, applying it to the flag texture (if there is one yet) and setting this node's
+		 * material and instance shader parameters to draw it, see UITools::apply_texture_shader_mode. */
+		godot::Error set_shader_mode(bool new_shader_mode);
 	};
 }
@@ -30,6 +30,7 @@
 #include <godot_cpp/variant/vector2i.hpp>
 
 #include "openvic-extension/core/Bind.hpp"
+#include "openvic-extension/singletons/AssetManager.hpp"
 #include "openvic-extension/utility/UITools.hpp"
 #include "openvic-extension/utility/Utilities.hpp"
 
@@ -291,7 +292,10 @@ bool GUINode::_update_click_mask_for(Ref<Image> const& img, int index) {
 	ERR_FAIL_COND_V(img.is_null(), false);
 	Ref<Texture2D> texture = get_texture_from_node(control);
 	ERR_FAIL_COND_V(texture.is_null(), false);
-	Ref<Image> texture_img = texture->get_image();
+	/* Atlas-packed textures are read from the CPU-side page image, rather than reading the whole page back. */
+	AssetManager const* asset_manager = AssetManager::get_singleton();
+	Ref<Image> texture_img = asset_manager != nullptr ? asset_manager->get_texture_image(texture) : texture->get_image();
+	ERR_FAIL_NULL_V(texture_img, false);
 	if (img->is_empty()) {
 		img->copy_from(texture_img);
 	} else {
@@ -1,9 +1,11 @@
 #include "GUIPieChart.hpp"
 
 #include <godot_cpp/classes/input_event_mouse_motion.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
 
 #include "openvic-extension/core/Bind.hpp"
 #include "openvic-extension/singletons/MenuSingleton.hpp"
+#include "openvic-extension/utility/UITools.hpp"
 #include "openvic-extension/utility/Utilities.hpp"
 
 using namespace godot;
@@ -18,7 +20,7 @@ void GUIPieChart::_update_tooltip() {
 		GFXPieChartTexture::slice_t const* slice = gfx_pie_chart_texture->get_slice(tooltip_position);
 
 		if (slice != nullptr) {
-			menu_singleton->show_control_tooltip(slice->tooltip, {}, this);
+			menu_singleton->show_control_tooltip(gfx_pie_chart_texture->get_slice_tooltip(*slice), {}, this);
 
 			tooltip_active = true;
 			return;
@@ -34,6 +36,14 @@ void GUIPieChart::_bind_methods() {
 	OV_BIND_METHOD(GUIPieChart::set_gfx_pie_chart_name, { "gfx_pie_chart_name" });
 	OV_BIND_METHOD(GUIPieChart::get_gfx_pie_chart_name);
 	OV_BIND_METHOD(GUIPieChart::set_slices_array, { "new_slices" });
+	OV_BIND_METHOD(
+		GUIPieChart::set_slices_packed, { "identifiers", "colours", "weights", "start", "end" }, DEFVAL(0), DEFVAL(-1)
+	);
+
+	OV_BIND_METHOD(GUIPieChart::set_shader_mode, { "new_shader_mode" });
+	OV_BIND_METHOD(GUIPieChart::is_shader_mode);
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "shader_mode"), "set_shader_mode", "is_shader_mode");
 }
 
 static const Vector2 disabled_tooltip_position { -1.0_real, -1.0_real };
@@ -58,12 +68,31 @@ void GUIPieChart::_gui_input(Ref<InputEvent> const& event) {
 
 GUIPieChart::GUIPieChart() : tooltip_position { disabled_tooltip_position } {}
 
+Error GUIPieChart::_apply_shader_mode() {
+	return UITools::apply_texture_shader_mode(*this, *gfx_pie_chart_texture.ptr(), shader_mode);
+}
+
+void GUIPieChart::_on_texture_changed() {
+	if (shader_mode) {
+		_apply_shader_mode();
+	}
+}
+
+Error GUIPieChart::_make_gfx_pie_chart_texture() {
+	static const StringName changed_signal = "changed";
+
+	gfx_pie_chart_texture.instantiate();
+	ERR_FAIL_NULL_V(gfx_pie_chart_texture, FAILED);
+	gfx_pie_chart_texture->connect(changed_signal, callable_mp(this, &GUIPieChart::_on_texture_changed));
+	/* Applied before the pie chart is set, so the image is never needlessly drawn on the CPU. */
+	return _apply_shader_mode();
+}
+
 Error GUIPieChart::set_gfx_pie_chart(GFX::PieChart const* gfx_pie_chart) {
 	const bool needs_setting = gfx_pie_chart_texture.is_null();
 
 	if (needs_setting) {
-		gfx_pie_chart_texture.instantiate();
-		ERR_FAIL_NULL_V(gfx_pie_chart_texture, FAILED);
+		ERR_FAIL_COND_V(_make_gfx_pie_chart_texture() != OK, FAILED);
 	}
 
 	const Error err = gfx_pie_chart_texture->set_gfx_pie_chart(gfx_pie_chart);
@@ -89,8 +118,7 @@ Error GUIPieChart::set_gfx_pie_chart_name(String const& gfx_pie_chart_name) {
 	const bool needs_setting = gfx_pie_chart_texture.is_null();
 
 	if (needs_setting) {
-		gfx_pie_chart_texture.instantiate();
-		ERR_FAIL_NULL_V(gfx_pie_chart_texture, FAILED);
+		ERR_FAIL_COND_V(_make_gfx_pie_chart_texture() != OK, FAILED);
 	}
 
 	const Error err = gfx_pie_chart_texture->set_gfx_pie_chart_name(gfx_pie_chart_name);
@@ -123,3 +151,28 @@ Error GUIPieChart::set_slices_array(GFXPieChartTexture::godot_pie_chart_data_t c
 
 	return err;
 }
+
+Error GUIPieChart::set_slices_packed(
+	PackedStringArray const& identifiers, PackedColorArray const& colours, PackedFloat32Array const& weights, int64_t start,
+	int64_t end
+) {
+	ERR_FAIL_NULL_V(gfx_pie_chart_texture, FAILED);
+
+	const Error err = gfx_pie_chart_texture->set_slices_packed(identifiers, colours, weights, start, end);
+
+	if (tooltip_active) {
+		_update_tooltip();
+	}
+
+	return err;
+}
+
+Error GUIPieChart::set_shader_mode(bool new_shader_mode) {
+	shader_mode = new_shader_mode;
+
+	if (gfx_pie_chart_texture.is_null()) {
+		return OK;
+	}
+
+	return _apply_shader_mode();
+}
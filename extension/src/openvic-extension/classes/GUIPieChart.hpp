@@ -13,6 +13,13 @@ namespace OpenVic {
 
 		godot::Ref<GFXPieChartTexture> gfx_pie_chart_texture;
 
+		/* Whether the slices are drawn at draw time by a shader, see GFXPieChartTexture::set_shader_mode. */
+		bool PROPERTY_CUSTOM_PREFIX(shader_mode, is, false);
+
+		godot::Error _apply_shader_mode();
+		void _on_texture_changed();
+		godot::Error _make_gfx_pie_chart_texture();
+
 		bool tooltip_active = false;
 		godot::Vector2 tooltip_position;
 
@@ -37,5 +44,14 @@ namespace OpenVic {
 		godot::String get_gfx_pie_chart_name() const;
 
 		godot::Error set_slices_array(GFXPieChartTexture::godot_pie_chart_data_t const& new_slices);
+
+		godot::Error set_slices_packed(
+			godot::PackedStringArray const& identifiers, godot::PackedColorArray const& colours,
+			godot::PackedFloat32Array const& weights, int64_t start = 0, int64_t end = -1
+		);
+
+		/* Enable or disable shader mode, applying it to the pie chart texture (if there is one yet) and setting this node's
+		 * material and instance shader parameters to draw it, see UITools::apply_texture_shader_mode. */
+		godot::Error set_shader_mode(bool new_shader_mode);
 	};
 }
@@ -82,6 +82,11 @@ void initialize_openvic_types(ModuleInitializationLevel p_level) {
 	_map_item_singleton = memnew(MapItemSingleton);
 	Engine::get_singleton()->register_singleton("MapItemSingleton", MapItemSingleton::get_singleton());
 
+	/* Created before the MenuSingleton, which observes changes of player country. */
+	ClassDB::register_class<PlayerSingleton>();
+	_player_singleton = memnew(PlayerSingleton);
+	Engine::get_singleton()->register_singleton("PlayerSingleton", PlayerSingleton::get_singleton());
+
 	ClassDB::register_class<MenuSingleton>();
 	_menu_singleton = memnew(MenuSingleton);
 	Engine::get_singleton()->register_singleton("MenuSingleton", MenuSingleton::get_singleton());
@@ -98,10 +103,6 @@ void initialize_openvic_types(ModuleInitializationLevel p_level) {
 	_sound_singleton = memnew(SoundSingleton);
 	Engine::get_singleton()->register_singleton("SoundSingleton", SoundSingleton::get_singleton());
 
-	ClassDB::register_class<PlayerSingleton>();
-	_player_singleton = memnew(PlayerSingleton);
-	Engine::get_singleton()->register_singleton("PlayerSingleton", PlayerSingleton::get_singleton());
-
 	ClassDB::register_class<MapMesh>();
 	ClassDB::register_abstract_class<GFXCorneredTileSupportingTexture>();
 
@@ -159,6 +160,9 @@ void uninitialize_openvic_types(ModuleInitializationLevel p_level) {
 	Engine::get_singleton()->unregister_singleton("MapItemSingleton");
 	memdelete(_map_item_singleton);
 
+	Engine::get_singleton()->unregister_singleton("PlayerSingleton");
+	memdelete(_player_singleton);
+
 	Engine::get_singleton()->unregister_singleton("MenuSingleton");
 	memdelete(_menu_singleton);
 
@@ -171,9 +175,6 @@ void uninitialize_openvic_types(ModuleInitializationLevel p_level) {
 	Engine::get_singleton()->unregister_singleton("SoundSingleton");
 	memdelete(_sound_singleton);
 
-	Engine::get_singleton()->unregister_singleton("PlayerSingleton");
-	memdelete(_player_singleton);
-
 	unregister_core_types();
 }
 
@@ -1,7 +1,12 @@
 #include "AssetManager.hpp"
 
+#include <limits>
+
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+
 #include "openvic-extension/core/Convert.hpp"
 #include "openvic-extension/singletons/GameSingleton.hpp"
 #include "openvic-extension/core/Bind.hpp"
@@ -11,17 +16,49 @@
 using namespace godot;
 using namespace OpenVic;
 
+StringName const& AssetManager::_signal_image_request_completed() {
+	static const StringName signal_image_request_completed = "image_request_completed";
+	return signal_image_request_completed;
+}
+
+StringName const& AssetManager::_signal_frame_pre_draw() {
+	static const StringName signal_frame_pre_draw = "frame_pre_draw";
+	return signal_frame_pre_draw;
+}
+
 void AssetManager::_bind_methods() {
 	OV_BIND_METHOD(AssetManager::get_image, { "path", "load_flags" }, DEFVAL(LOAD_FLAG_CACHE_IMAGE));
+	OV_BIND_METHOD(AssetManager::request_image, { "path", "load_flags" }, DEFVAL(LOAD_FLAG_CACHE_IMAGE));
+	OV_BIND_METHOD(AssetManager::is_image_request_completed, { "ticket" });
+	OV_BIND_METHOD(AssetManager::get_requested_image, { "ticket" });
 	OV_BIND_METHOD(AssetManager::get_texture, { "path", "load_flags" }, DEFVAL(LOAD_FLAG_CACHE_TEXTURE));
 	OV_BIND_METHOD(AssetManager::get_font, { "name" });
 	OV_BIND_METHOD(AssetManager::get_currency_texture, { "height" });
 	OV_BIND_METHOD(AssetManager::get_leader_texture, { "name" });
 
+	OV_BIND_METHOD(AssetManager::set_image_cache_budget, { "new_image_cache_budget" });
+	OV_BIND_METHOD(AssetManager::get_image_cache_budget);
+	OV_BIND_METHOD(AssetManager::set_texture_cache_budget, { "new_texture_cache_budget" });
+	OV_BIND_METHOD(AssetManager::get_texture_cache_budget);
+	OV_BIND_METHOD(AssetManager::set_image_pinned, { "path", "pinned" });
+	OV_BIND_METHOD(AssetManager::clear_image_cache);
+	OV_BIND_METHOD(AssetManager::get_image_cache_stats);
+	OV_BIND_METHOD(AssetManager::flush_atlas_pages);
+	OV_BIND_METHOD(AssetManager::get_texture_image, { "texture" });
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "image_cache_budget"), "set_image_cache_budget", "get_image_cache_budget");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "texture_cache_budget"), "set_texture_cache_budget", "get_texture_cache_budget");
+
 	BIND_BITFIELD_FLAG(LOAD_FLAG_NONE);
 	BIND_BITFIELD_FLAG(LOAD_FLAG_CACHE_IMAGE);
 	BIND_BITFIELD_FLAG(LOAD_FLAG_CACHE_TEXTURE);
 	BIND_BITFIELD_FLAG(LOAD_FLAG_FLIP_Y);
+	BIND_BITFIELD_FLAG(LOAD_FLAG_KEEP_COMPRESSED);
+
+	ADD_SIGNAL(MethodInfo(
+		_signal_image_request_completed(), PropertyInfo(Variant::INT, "ticket"), PropertyInfo(Variant::STRING_NAME, "path"),
+		PropertyInfo(Variant::OBJECT, "image", PROPERTY_HINT_RESOURCE_TYPE, "Image")
+	));
 }
 
 AssetManager* AssetManager::get_singleton() {
@@ -34,24 +71,58 @@ AssetManager::AssetManager() {
 }
 
 AssetManager::~AssetManager() {
+	/* Worker threads still decoding must finish before the requests they write to are destroyed. */
+	WorkerThreadPool* worker_thread_pool = WorkerThreadPool::get_singleton();
+	if (worker_thread_pool != nullptr) {
+		for (auto const& [ticket, request] : image_requests) {
+			if (request->task_id >= 0) {
+				worker_thread_pool->wait_for_task_completion(request->task_id);
+			}
+		}
+	}
+
+	RenderingServer* rendering_server = RenderingServer::get_singleton();
+	if (rendering_server != nullptr) {
+		if (atlas_update_queued) {
+			rendering_server->disconnect(_signal_frame_pre_draw(), callable_mp(this, &AssetManager::flush_atlas_pages));
+		}
+		if (cache_budgets_queued) {
+			rendering_server->disconnect(
+				_signal_frame_pre_draw(), callable_mp(this, &AssetManager::_enforce_queued_cache_budgets)
+			);
+		}
+	}
+
 	ERR_FAIL_COND(_singleton != this);
 	_singleton = nullptr;
 }
 
-Ref<Image> AssetManager::_load_image(StringName const& path, bool flip_y) {
+String AssetManager::_lookup_image(StringName const& path) {
 	GameSingleton* game_singleton = GameSingleton::get_singleton();
-	ERR_FAIL_NULL_V(game_singleton, nullptr);
+	ERR_FAIL_NULL_V(game_singleton, {});
 
 	const String lookedup_path = convert_to<String>(
 		game_singleton->get_dataloader().lookup_image_file(convert_to<std::string>(path)).string()
 	);
-	ERR_FAIL_COND_V_MSG(lookedup_path.is_empty(), nullptr, Utilities::format("Failed to look up image: %s", path));
+	ERR_FAIL_COND_V_MSG(lookedup_path.is_empty(), {}, Utilities::format("Failed to look up image: %s", path));
+
+	return lookedup_path;
+}
+
+Ref<Image> AssetManager::_decode_image(StringName const& path, String const& lookedup_path, BitField<LoadFlags> load_flags) {
+	const bool flip_y = load_flags & LOAD_FLAG_FLIP_Y;
 
-	const Ref<Image> image = Utilities::load_godot_image(lookedup_path);
+	/* Compressed images can't be flipped, so flipping takes priority over keeping the image compressed. */
+	const Ref<Image> image = Utilities::load_godot_image(lookedup_path, (load_flags & LOAD_FLAG_KEEP_COMPRESSED) && !flip_y);
 	ERR_FAIL_COND_V_MSG(
 		image.is_null() || image->is_empty(), nullptr,
 		Utilities::format("Failed to load image: %s (looked up: %s)", path, lookedup_path)
 	);
+
+	if (image->is_compressed()) {
+		return image;
+	}
+
 	if (image->detect_alpha() != Image::ALPHA_NONE) {
 		image->fix_alpha_edges();
 	}
@@ -63,34 +134,358 @@ Ref<Image> AssetManager::_load_image(StringName const& path, bool flip_y) {
 	return image;
 }
 
+Ref<Image> AssetManager::_load_image(StringName const& path, BitField<LoadFlags> load_flags) {
+	const String lookedup_path = _lookup_image(path);
+	if (lookedup_path.is_empty()) {
+		return nullptr;
+	}
+
+	return _decode_image(path, lookedup_path, load_flags);
+}
+
+AssetManager::image_asset_t& AssetManager::_get_image_asset(StringName const& path) {
+	image_asset_t& asset = image_assets[path];
+	asset.path = path;
+	return asset;
+}
+
+void AssetManager::_erase_image_asset(image_asset_t& asset) {
+	_unlink_image_asset(asset);
+	/* The path is copied as erasing destroys the asset holding it. */
+	const StringName path = asset.path;
+	image_assets.erase(path);
+}
+
+void AssetManager::_unlink_image_asset(image_asset_t& asset) {
+	if (asset.lru_prev != nullptr) {
+		asset.lru_prev->lru_next = asset.lru_next;
+	} else if (lru_front == &asset) {
+		lru_front = asset.lru_next;
+	}
+	if (asset.lru_next != nullptr) {
+		asset.lru_next->lru_prev = asset.lru_prev;
+	} else if (lru_back == &asset) {
+		lru_back = asset.lru_prev;
+	}
+	asset.lru_prev = nullptr;
+	asset.lru_next = nullptr;
+}
+
+void AssetManager::_touch_image_asset(image_asset_t& asset) {
+	if (lru_back == &asset) {
+		return;
+	}
+
+	_unlink_image_asset(asset);
+
+	asset.lru_prev = lru_back;
+	if (lru_back != nullptr) {
+		lru_back->lru_next = &asset;
+	} else {
+		lru_front = &asset;
+	}
+	lru_back = &asset;
+}
+
+void AssetManager::_cache_image(StringName const& path, Ref<Image> const& image) {
+	image_asset_t& asset = _get_image_asset(path);
+	_uncache_image(asset);
+
+	asset.image = image;
+	asset.image_bytes = image->get_data().size();
+	image_cache_bytes += asset.image_bytes;
+	_touch_image_asset(asset);
+
+	_queue_cache_budget_enforcement();
+}
+
+void AssetManager::_cache_texture(StringName const& path, Ref<ImageTexture> const& texture, int64_t bytes) {
+	image_asset_t& asset = _get_image_asset(path);
+	_uncache_texture(asset);
+
+	asset.texture = texture;
+	asset.texture_bytes = bytes;
+	texture_cache_bytes += asset.texture_bytes;
+	_touch_image_asset(asset);
+
+	_queue_cache_budget_enforcement();
+}
+
+void AssetManager::_uncache_image(image_asset_t& asset) {
+	image_cache_bytes -= asset.image_bytes;
+	asset.image_bytes = 0;
+	asset.image.unref();
+}
+
+void AssetManager::_uncache_texture(image_asset_t& asset) {
+	texture_cache_bytes -= asset.texture_bytes;
+	asset.texture_bytes = 0;
+	asset.texture.unref();
+}
+
+void AssetManager::_queue_cache_budget_enforcement() {
+	if (cache_budgets_queued || (image_cache_bytes <= image_cache_budget && texture_cache_bytes <= texture_cache_budget)) {
+		return;
+	}
+
+	RenderingServer* rendering_server = RenderingServer::get_singleton();
+	if (rendering_server != nullptr) {
+		cache_budgets_queued = true;
+		rendering_server->connect(
+			_signal_frame_pre_draw(), callable_mp(this, &AssetManager::_enforce_queued_cache_budgets),
+			Object::CONNECT_ONE_SHOT
+		);
+	} else {
+		_enforce_cache_budgets();
+	}
+}
+
+void AssetManager::_enforce_queued_cache_budgets() {
+	cache_budgets_queued = false;
+	_enforce_cache_budgets();
+}
+
+void AssetManager::_enforce_cache_budgets() {
+	/* A reference count of 1 means only the cache holds the resource, so evicting it will actually free it. */
+	const auto is_evictable = [](auto const& resource) -> bool {
+		return resource.is_valid() && resource->get_reference_count() == 1;
+	};
+
+	/* Assets moved to the back are never revisited, as the walk ends at the asset which was at the back to begin with. */
+	image_asset_t* const last = lru_back;
+	image_asset_t* asset = lru_front;
+	while (asset != nullptr && (image_cache_bytes > image_cache_budget || texture_cache_bytes > texture_cache_budget)) {
+		image_asset_t* const next = asset != last ? asset->lru_next : nullptr;
+
+		if (!asset->pinned) {
+			if (image_cache_bytes > image_cache_budget && is_evictable(asset->image)) {
+				_uncache_image(*asset);
+				++image_evictions;
+			}
+			if (texture_cache_bytes > texture_cache_budget && is_evictable(asset->texture)) {
+				_uncache_texture(*asset);
+				++texture_evictions;
+			}
+		}
+
+		if (asset->image.is_null() && asset->texture.is_null()) {
+			/* Fully evicted entries are erased, so the next request for them is treated as a fresh load. */
+			if (asset->pinned) {
+				_unlink_image_asset(*asset);
+			} else {
+				_erase_image_asset(*asset);
+			}
+		} else if (asset->pinned || !(is_evictable(asset->image) || is_evictable(asset->texture))) {
+			_touch_image_asset(*asset);
+		}
+
+		asset = next;
+	}
+}
+
 Ref<Image> AssetManager::get_image(StringName const& path, BitField<LoadFlags> load_flags) {
 	/* Check for an existing image entry indicating a previous load attempt, whether successful or not. */
 	const image_asset_map_t::Iterator it = image_assets.find(path);
 	if (it != image_assets.end() && it->value.image.is_valid()) {
+		_touch_image_asset(it->value);
+		++cache_hits;
 		return it->value.image;
 	}
 
+	++cache_misses;
+
 	/* No load attempt has been made yet, so we try now. */
-	const Ref<Image> image = _load_image(path, load_flags & LOAD_FLAG_FLIP_Y);
+	const Ref<Image> image = _load_image(path, load_flags);
 
 	if (image.is_valid()) {
-		if (load_flags & LOAD_FLAG_CACHE_IMAGE) {
-			image_assets[path].image = image;
+		if ((load_flags & LOAD_FLAG_CACHE_IMAGE) && !image->is_compressed()) {
+			_cache_image(path, image);
 		}
 
 		return image;
 	} else {
 		/* Mark both image and texture as failures, regardless of cache flags, in case of future load/creation attempts. */
-		image_assets[path] = {};
+		image_asset_t& asset = _get_image_asset(path);
+		_uncache_image(asset);
+		_uncache_texture(asset);
 
 		ERR_FAIL_V_MSG(nullptr, Utilities::format("Failed to load image: %s", path));
 	}
 }
 
+int64_t AssetManager::request_image(StringName const& path, BitField<LoadFlags> load_flags) {
+	WorkerThreadPool* worker_thread_pool = WorkerThreadPool::get_singleton();
+	ERR_FAIL_NULL_V(worker_thread_pool, -1);
+
+	memory::unique_ptr<image_request_t> new_request = memory::make_unique<image_request_t>();
+	new_request->path = path;
+	new_request->load_flags = load_flags;
+
+	const image_asset_map_t::Iterator it = image_assets.find(path);
+	if (it != image_assets.end() && it->value.image.is_valid()) {
+		/* The image is already cached, so there's nothing to decode. */
+		new_request->image = it->value.image;
+		new_request->decoded = true;
+	} else {
+		/* The lookup goes through the GameSingleton's Dataloader, so it can't be moved to a worker thread. */
+		new_request->lookedup_path = _lookup_image(path);
+		if (new_request->lookedup_path.is_empty()) {
+			image_asset_t& asset = _get_image_asset(path);
+			_uncache_image(asset);
+			_uncache_texture(asset);
+			return -1;
+		}
+	}
+
+	const int64_t ticket = next_image_request_ticket++;
+	image_request_t& request = *new_request;
+	{
+		const std::lock_guard lock { image_request_mutex };
+		image_requests.emplace(ticket, std::move(new_request));
+	}
+
+	if (request.decoded) {
+		callable_mp(this, &AssetManager::_commit_image_requests).call_deferred();
+	} else {
+		request.task_id = worker_thread_pool->add_task(
+			callable_mp(this, &AssetManager::_decode_image_request).bind(ticket), false,
+			Utilities::format("Decode image: %s", path)
+		);
+	}
+
+	return ticket;
+}
+
+void AssetManager::_decode_image_request(int64_t ticket) {
+	image_request_t* request;
+	{
+		const std::lock_guard lock { image_request_mutex };
+		const image_request_map_t::iterator it = image_requests.find(ticket);
+		ERR_FAIL_COND(it == image_requests.end());
+		request = it->second.get();
+	}
+
+	/* path, lookedup_path and load_flags are never modified after the request is added, so are safe to read here. */
+	const Ref<Image> image = _decode_image(request->path, request->lookedup_path, request->load_flags);
+
+	{
+		const std::lock_guard lock { image_request_mutex };
+		request->image = image;
+		request->decoded = true;
+	}
+
+	callable_mp(this, &AssetManager::_commit_image_requests).call_deferred();
+}
+
+void AssetManager::_commit_image_requests() {
+	WorkerThreadPool* worker_thread_pool = WorkerThreadPool::get_singleton();
+	ERR_FAIL_NULL(worker_thread_pool);
+
+	while (next_image_request_to_commit < next_image_request_ticket) {
+		const int64_t ticket = next_image_request_to_commit;
+
+		image_request_t* request;
+		{
+			const std::lock_guard lock { image_request_mutex };
+			const image_request_map_t::iterator it = image_requests.find(ticket);
+			ERR_FAIL_COND(it == image_requests.end());
+			request = it->second.get();
+			if (!request->decoded) {
+				/* Later requests must wait for this one, even if they've already been decoded. */
+				return;
+			}
+		}
+
+		if (request->task_id >= 0) {
+			/* Every WorkerThreadPool task must be waited on exactly once, even after it has finished. */
+			worker_thread_pool->wait_for_task_completion(request->task_id);
+			request->task_id = -1;
+		}
+
+		/* Mirrors get_image's caching, except that an image cached since the request was made takes priority. */
+		const image_asset_map_t::Iterator it = image_assets.find(request->path);
+		if (request->image.is_null()) {
+			image_asset_t& asset = _get_image_asset(request->path);
+			_uncache_image(asset);
+			_uncache_texture(asset);
+		} else if (it != image_assets.end() && it->value.image.is_valid()) {
+			request->image = it->value.image;
+		} else if ((request->load_flags & LOAD_FLAG_CACHE_IMAGE) && !request->image->is_compressed()) {
+			_cache_image(request->path, request->image);
+		}
+
+		++next_image_request_to_commit;
+
+		emit_signal(_signal_image_request_completed(), ticket, request->path, request->image);
+
+		/* The signal passes the image on, so unless the ticket is being redeemed it's no longer needed. Signal handlers
+		 * may have redeemed it already, so it has to be found again. */
+		const std::lock_guard lock { image_request_mutex };
+		const image_request_map_t::iterator request_it = image_requests.find(ticket);
+		if (request_it != image_requests.end() && !request_it->second->redeeming) {
+			image_requests.erase(request_it);
+		}
+	}
+}
+
+bool AssetManager::is_image_request_completed(int64_t ticket) const {
+	const std::lock_guard lock { image_request_mutex };
+	const image_request_map_t::const_iterator it = image_requests.find(ticket);
+	return it != image_requests.end() && it->second->decoded;
+}
+
+Ref<Image> AssetManager::get_requested_image(int64_t ticket) {
+	WorkerThreadPool* worker_thread_pool = WorkerThreadPool::get_singleton();
+	ERR_FAIL_NULL_V(worker_thread_pool, nullptr);
+
+	ERR_FAIL_COND_V_MSG(
+		ticket < 1 || ticket >= next_image_request_ticket, nullptr,
+		Utilities::format("Invalid image request ticket: %d", ticket)
+	);
+
+	{
+		const std::lock_guard lock { image_request_mutex };
+		const image_request_map_t::iterator it = image_requests.find(ticket);
+		ERR_FAIL_COND_V_MSG(
+			it == image_requests.end(), nullptr,
+			Utilities::format("Image request ticket already redeemed or completed: %d", ticket)
+		);
+		it->second->redeeming = true;
+	}
+
+	/* Commit order is fixed, so every earlier request must also be finished before this one can be committed. */
+	for (int64_t earlier_ticket = next_image_request_to_commit; earlier_ticket <= ticket; ++earlier_ticket) {
+		image_request_t* request;
+		{
+			const std::lock_guard lock { image_request_mutex };
+			const image_request_map_t::iterator it = image_requests.find(earlier_ticket);
+			ERR_FAIL_COND_V(it == image_requests.end(), nullptr);
+			request = it->second.get();
+		}
+
+		if (request->task_id >= 0) {
+			worker_thread_pool->wait_for_task_completion(request->task_id);
+			request->task_id = -1;
+		}
+	}
+
+	_commit_image_requests();
+
+	const std::lock_guard lock { image_request_mutex };
+	const image_request_map_t::iterator it = image_requests.find(ticket);
+	ERR_FAIL_COND_V(it == image_requests.end(), nullptr);
+
+	const Ref<Image> image = it->second->image;
+	image_requests.erase(it);
+	return image;
+}
+
 Ref<ImageTexture> AssetManager::get_texture(StringName const& path, BitField<LoadFlags> load_flags) {
 	/* Check for an existing texture entry indicating a previous creation attempt, whether successful or not. */
 	const image_asset_map_t::Iterator it = image_assets.find(path);
 	if (it != image_assets.end() && it->value.texture.is_valid()) {
+		_touch_image_asset(it->value);
+		++cache_hits;
 		return it->value.texture;
 	}
 
@@ -102,18 +497,369 @@ Ref<ImageTexture> AssetManager::get_texture(StringName const& path, BitField<Loa
 
 	if (texture.is_valid()) {
 		if (load_flags & LOAD_FLAG_CACHE_TEXTURE) {
-			image_assets[path].texture = texture;
+			/* The texture is uploaded straight from the image, so its GPU footprint matches the image's data size. */
+			_cache_texture(path, texture, image->get_data().size());
+
+			/* Once uploaded, the CPU-side image is only kept if it was explicitly requested or pinned. */
+			image_asset_t& asset = _get_image_asset(path);
+			if (!(load_flags & LOAD_FLAG_CACHE_IMAGE) && !asset.pinned && asset.image.is_valid()) {
+				_uncache_image(asset);
+			}
 		}
 
 		return texture;
 	} else {
 		/* Mark texture as a failure, regardless of cache flags, in case of future creation attempts. */
-		image_assets[path].texture = Ref<ImageTexture> {};
+		_uncache_texture(_get_image_asset(path));
 
 		ERR_FAIL_V_MSG(nullptr, Utilities::format("Failed to create texture: %s", path));
 	}
 }
 
+void AssetManager::set_image_cache_budget(int64_t new_image_cache_budget) {
+	ERR_FAIL_COND(new_image_cache_budget < 0);
+	image_cache_budget = new_image_cache_budget;
+	_enforce_cache_budgets();
+}
+
+void AssetManager::set_texture_cache_budget(int64_t new_texture_cache_budget) {
+	ERR_FAIL_COND(new_texture_cache_budget < 0);
+	texture_cache_budget = new_texture_cache_budget;
+	_enforce_cache_budgets();
+}
+
+void AssetManager::set_image_pinned(StringName const& path, bool pinned) {
+	/* Pinning creates an entry if needed, so paths can be pinned before they're first loaded. */
+	_get_image_asset(path).pinned = pinned;
+	if (!pinned) {
+		_enforce_cache_budgets();
+	}
+}
+
+void AssetManager::clear_image_cache() {
+	memory::vector<image_asset_t*> emptied_assets;
+
+	for (KeyValue<StringName, image_asset_t>& key_value : image_assets) {
+		image_asset_t& asset = key_value.value;
+		if (!asset.pinned) {
+			_uncache_image(asset);
+			_uncache_texture(asset);
+			emptied_assets.push_back(&asset);
+		}
+	}
+
+	for (image_asset_t* asset : emptied_assets) {
+		_erase_image_asset(*asset);
+	}
+}
+
+Dictionary AssetManager::get_image_cache_stats() const {
+	static const StringName image_count_key = "image_count";
+	static const StringName image_bytes_key = "image_bytes";
+	static const StringName image_budget_key = "image_budget";
+	static const StringName image_evictions_key = "image_evictions";
+	static const StringName texture_count_key = "texture_count";
+	static const StringName texture_bytes_key = "texture_bytes";
+	static const StringName texture_budget_key = "texture_budget";
+	static const StringName texture_evictions_key = "texture_evictions";
+	static const StringName pinned_count_key = "pinned_count";
+	static const StringName atlas_page_count_key = "atlas_page_count";
+	static const StringName atlas_image_count_key = "atlas_image_count";
+	static const StringName atlas_page_bytes_key = "atlas_page_bytes";
+	static const StringName button_state_count_key = "button_state_count";
+	static const StringName masked_flag_count_key = "masked_flag_count";
+	static const StringName pie_chart_count_key = "pie_chart_count";
+	static const StringName shaped_text_count_key = "shaped_text_count";
+	static const StringName hits_key = "hits";
+	static const StringName misses_key = "misses";
+
+	int64_t image_count = 0, texture_count = 0, pinned_count = 0;
+	for (KeyValue<StringName, image_asset_t> const& key_value : image_assets) {
+		image_asset_t const& asset = key_value.value;
+		image_count += asset.image.is_valid();
+		texture_count += asset.texture.is_valid();
+		pinned_count += asset.pinned;
+	}
+
+	int64_t atlas_image_count = 0;
+	for (KeyValue<StringName, atlas_entry_t> const& key_value : atlas_entries) {
+		atlas_image_count += key_value.value.page_index >= 0;
+	}
+
+	Dictionary ret;
+
+	ret[image_count_key] = image_count;
+	ret[image_bytes_key] = image_cache_bytes;
+	ret[image_budget_key] = image_cache_budget;
+	ret[image_evictions_key] = image_evictions;
+	ret[texture_count_key] = texture_count;
+	ret[texture_bytes_key] = texture_cache_bytes;
+	ret[texture_budget_key] = texture_cache_budget;
+	ret[texture_evictions_key] = texture_evictions;
+	ret[pinned_count_key] = pinned_count;
+	ret[atlas_page_count_key] = static_cast<int64_t>(atlas_pages.size());
+	ret[atlas_image_count_key] = atlas_image_count;
+	ret[atlas_page_bytes_key] = atlas_page_bytes;
+	ret[button_state_count_key] = static_cast<int64_t>(button_state_entries.size());
+	ret[masked_flag_count_key] = static_cast<int64_t>(masked_flag_cache.size());
+	ret[pie_chart_count_key] = static_cast<int64_t>(pie_chart_cache.size());
+	ret[shaped_text_count_key] = static_cast<int64_t>(shaped_text_cache.size());
+	ret[hits_key] = cache_hits;
+	ret[misses_key] = cache_misses;
+
+	return ret;
+}
+
+AssetManager::atlas_entry_t AssetManager::_allocate_atlas_region(Vector2i const& size) {
+	static const Vector2i padding { ATLAS_PADDING, ATLAS_PADDING };
+	const Vector2i padded_size = size + padding * 2;
+
+	/* Reuse the smallest released slot the image fits in, if there is one. */
+	int32_t best_page_index = -1;
+	size_t best_slot_index = 0;
+	int64_t best_slot_area = std::numeric_limits<int64_t>::max();
+	for (size_t page_index = 0; page_index < atlas_pages.size(); ++page_index) {
+		memory::vector<Rect2i> const& free_slots = atlas_pages[page_index].free_slots;
+		for (size_t slot_index = 0; slot_index < free_slots.size(); ++slot_index) {
+			Rect2i const& slot = free_slots[slot_index];
+			const int64_t slot_area = static_cast<int64_t>(slot.size.x) * slot.size.y;
+			if (slot.size.x >= padded_size.x && slot.size.y >= padded_size.y && slot_area < best_slot_area) {
+				best_page_index = page_index;
+				best_slot_index = slot_index;
+				best_slot_area = slot_area;
+			}
+		}
+	}
+
+	if (best_page_index >= 0) {
+		atlas_page_t& page = atlas_pages[best_page_index];
+		const Rect2i slot = page.free_slots[best_slot_index];
+		page.free_slots[best_slot_index] = page.free_slots.back();
+		page.free_slots.pop_back();
+
+		/* Clear whatever was previously drawn here, so any of the slot not covered by the new image is transparent. */
+		page.image->fill_rect(slot, { 0.0f, 0.0f, 0.0f, 0.0f });
+
+		return { best_page_index, { slot.position + padding, size }, slot };
+	}
+
+	if (!atlas_pages.empty()) {
+		atlas_page_t& page = atlas_pages.back();
+
+		Vector2i position = page.shelf_position;
+		int32_t shelf_height = page.shelf_height;
+
+		if (position.x + padded_size.x > ATLAS_PAGE_SIZE) {
+			/* Start a new shelf below the current one. */
+			position = { 0, position.y + shelf_height };
+			shelf_height = 0;
+		}
+
+		if (position.y + padded_size.y <= ATLAS_PAGE_SIZE) {
+			page.shelf_position = { position.x + padded_size.x, position.y };
+			page.shelf_height = std::max(shelf_height, padded_size.y);
+
+			return {
+				static_cast<int32_t>(atlas_pages.size() - 1), { position + padding, size }, { position, padded_size }
+			};
+		}
+	}
+
+	/* The current page is full (or there isn't one yet), so start a new one. */
+	atlas_page_t new_page;
+
+	new_page.image = Image::create(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, false, Image::FORMAT_RGBA8);
+	ERR_FAIL_NULL_V(new_page.image, {});
+
+	new_page.shelf_position = { padded_size.x, 0 };
+	new_page.shelf_height = padded_size.y;
+
+	atlas_pages.push_back(std::move(new_page));
+
+	/* Pages are never evicted, so are kept out of the cache budgets, which only limit evictable assets. */
+	atlas_page_bytes += atlas_pages.back().image->get_data().size();
+
+	return { static_cast<int32_t>(atlas_pages.size() - 1), { padding, size }, { {}, padded_size } };
+}
+
+void AssetManager::flush_atlas_pages() {
+	atlas_update_queued = false;
+
+	for (atlas_page_t& page : atlas_pages) {
+		if (page.dirty && page.texture.is_valid()) {
+			page.texture->update(page.image);
+			page.dirty = false;
+		}
+	}
+}
+
+Ref<Image> AssetManager::get_texture_image(Ref<Texture2D> const& texture) const {
+	ERR_FAIL_NULL_V(texture, nullptr);
+
+	AtlasTexture const* atlas_texture = Object::cast_to<AtlasTexture>(texture.ptr());
+	if (atlas_texture != nullptr) {
+		const Ref<Texture2D> atlas = atlas_texture->get_atlas();
+		for (atlas_page_t const& page : atlas_pages) {
+			if (page.texture.is_valid() && page.texture.ptr() == atlas.ptr()) {
+				/* The page image is always up to date, even if the page texture is yet to be updated. */
+				return page.image->get_region(Rect2i { atlas_texture->get_region() });
+			}
+		}
+	}
+
+	return texture->get_image();
+}
+
+AssetManager::atlas_entry_t AssetManager::_pack_atlas_image(Ref<Image> const& image) {
+	const Vector2i size = image->get_size();
+	if (image->is_compressed() || size.x > ATLAS_MAX_IMAGE_SIZE || size.y > ATLAS_MAX_IMAGE_SIZE) {
+		return {};
+	}
+
+	Ref<Image> source_image = image;
+	if (image->get_format() != Image::FORMAT_RGBA8) {
+		source_image.instantiate();
+		ERR_FAIL_NULL_V(source_image, {});
+		source_image->copy_from(image);
+		source_image->convert(Image::FORMAT_RGBA8);
+	}
+
+	const atlas_entry_t entry = _allocate_atlas_region(size);
+	ERR_FAIL_COND_V(entry.page_index < 0, {});
+
+	atlas_page_t& page = atlas_pages[entry.page_index];
+	page.image->blit_rect(source_image, { {}, size }, entry.region.position);
+
+	if (page.texture.is_null()) {
+		/* A new page is uploaded straight away, so its first image can be drawn (or read back) immediately. */
+		page.texture = ImageTexture::create_from_image(page.image);
+		ERR_FAIL_NULL_V(page.texture, {});
+		return entry;
+	}
+
+	page.dirty = true;
+
+	if (!atlas_update_queued) {
+		/* Uploads are batched until just before the frame is drawn, so nothing is ever drawn from a stale page. */
+		RenderingServer* rendering_server = RenderingServer::get_singleton();
+		if (rendering_server != nullptr) {
+			atlas_update_queued = true;
+			rendering_server->connect(
+				_signal_frame_pre_draw(), callable_mp(this, &AssetManager::flush_atlas_pages), Object::CONNECT_ONE_SHOT
+			);
+		} else {
+			flush_atlas_pages();
+		}
+	}
+
+	return entry;
+}
+
+void AssetManager::_release_atlas_region(atlas_entry_t const& entry) {
+	ERR_FAIL_INDEX(entry.page_index, atlas_pages.size());
+
+	/* The slot's pixels are left as they are until it's reused, as nothing draws from it in the meantime. */
+	atlas_pages[entry.page_index].free_slots.push_back(entry.slot);
+}
+
+AssetManager::atlas_region_t AssetManager::get_atlas_region(StringName const& path) {
+	const atlas_entry_map_t::Iterator it = atlas_entries.find(path);
+	if (it != atlas_entries.end()) {
+		atlas_entry_t const& entry = it->value;
+		if (entry.page_index < 0) {
+			return {};
+		}
+		atlas_page_t const& page = atlas_pages[entry.page_index];
+		return { page.image, page.texture, entry.region };
+	}
+
+	atlas_entry_t& entry = atlas_entries[path];
+
+	/* The image itself isn't cached, as once it's been blitted to the page it's no longer needed, unless it has been
+	 * pinned (e.g. by preload_textures) in which case it's expected to stay available without reloading. */
+	const image_asset_map_t::ConstIterator asset_it = image_assets.find(path);
+	const bool pinned = asset_it != image_assets.end() && asset_it->value.pinned;
+	const Ref<Image> image = get_image(path, pinned ? LOAD_FLAG_CACHE_IMAGE : LOAD_FLAG_NONE);
+	ERR_FAIL_NULL_V(image, {});
+
+	entry = _pack_atlas_image(image);
+	if (entry.page_index < 0) {
+		return {};
+	}
+
+	atlas_page_t const& page = atlas_pages[entry.page_index];
+	return { page.image, page.texture, entry.region };
+}
+
+uint32_t AssetManager::button_state_key_t::hash(button_state_key_t const& key) {
+	uint32_t hash = hash_murmur3_one_32(key.source_key.hash());
+	hash = hash_murmur3_one_32(key.region.position.x, hash);
+	hash = hash_murmur3_one_32(key.region.position.y, hash);
+	hash = hash_murmur3_one_32(key.region.size.x, hash);
+	hash = hash_murmur3_one_32(key.region.size.y, hash);
+	hash = hash_murmur3_one_32(key.button_state, hash);
+	return hash_fmix32(hash);
+}
+
+AssetManager::atlas_region_t AssetManager::get_button_state_region(
+	GFXButtonStateTexture::ButtonState button_state, StringName const& source_key, Ref<Image> const& source_image,
+	Rect2i const& region
+) {
+	ERR_FAIL_COND_V(source_key.is_empty(), {});
+	ERR_FAIL_NULL_V(source_image, {});
+
+	const button_state_key_t key { source_key, region, button_state };
+
+	button_state_entry_t const* cached_entry = button_state_entries.find(key);
+	if (cached_entry != nullptr) {
+		if (cached_entry->atlas_entry.page_index < 0) {
+			return { {}, cached_entry->texture, { {}, region.size }, cached_entry->users };
+		}
+		atlas_page_t const& page = atlas_pages[cached_entry->atlas_entry.page_index];
+		return { page.image, page.texture, cached_entry->atlas_entry.region, cached_entry->users };
+	}
+
+	const Ref<Image> state_image = GFXButtonStateTexture::make_state_image(button_state, source_image, region);
+	ERR_FAIL_NULL_V(state_image, {});
+
+	button_state_entry_t& entry = button_state_entries.insert(key, {}, [this](button_state_entry_t const& pruned_entry) {
+		if (pruned_entry.atlas_entry.page_index >= 0) {
+			_release_atlas_region(pruned_entry.atlas_entry);
+		}
+	});
+
+	entry.users.instantiate();
+	if (entry.users.is_null()) {
+		button_state_entries.erase(key);
+		ERR_FAIL_V_MSG({}, "Failed to create button state users reference!");
+	}
+
+	entry.atlas_entry = _pack_atlas_image(state_image);
+	if (entry.atlas_entry.page_index < 0) {
+		entry.texture = ImageTexture::create_from_image(state_image);
+		if (entry.texture.is_null()) {
+			button_state_entries.erase(key);
+			ERR_FAIL_V_MSG({}, "Failed to create button state texture!");
+		}
+		return { {}, entry.texture, { {}, region.size }, entry.users };
+	}
+
+	atlas_page_t const& page = atlas_pages[entry.atlas_entry.page_index];
+	return { page.image, page.texture, entry.atlas_entry.region, entry.users };
+}
+
+MaskedFlagCache& AssetManager::get_masked_flag_cache() {
+	return masked_flag_cache;
+}
+
+PieChartCache& AssetManager::get_pie_chart_cache() {
+	return pie_chart_cache;
+}
+
+ShapedTextCache& AssetManager::get_shaped_text_cache() {
+	return shaped_text_cache;
+}
+
 Ref<StyleBoxTexture> AssetManager::make_stylebox_texture(Ref<Texture2D> const& texture, Vector2 const& border) {
 	ERR_FAIL_NULL_V(texture, nullptr);
 
@@ -191,13 +937,16 @@ Error AssetManager::preload_textures() {
 
 	static const String missing_leader_sprite = "GFX_leader_generic0";
 
-	constexpr auto load = [](String const& sprite_name, Ref<GFXSpriteTexture>& texture) -> bool {
+	const auto load = [this](String const& sprite_name, Ref<GFXSpriteTexture>& texture) -> bool {
 		GFX::Sprite const* sprite = UITools::get_gfx_sprite(sprite_name);
 		ERR_FAIL_NULL_V(sprite, false);
 
 		GFX::IconTextureSprite const* icon_sprite = sprite->cast_to<GFX::IconTextureSprite>();
 		ERR_FAIL_NULL_V(icon_sprite, false);
 
+		/* These are needed throughout the session, so must never be evicted from the image cache. */
+		set_image_pinned(convert_to<String>(icon_sprite->get_texture_file()), true);
+
 		texture = GFXSpriteTexture::make_gfx_sprite_texture(icon_sprite);
 		ERR_FAIL_NULL_V(texture, false);
 
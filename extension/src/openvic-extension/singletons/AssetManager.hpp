@@ -1,16 +1,25 @@
 #pragma once
 
+#include <mutex>
+
 #include <godot_cpp/classes/atlas_texture.hpp>
 #include <godot_cpp/classes/font_file.hpp>
 #include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/style_box_texture.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/vector2.hpp>
 
+#include <openvic-simulation/core/memory/SmartPtr.hpp>
 #include <openvic-simulation/interface/GFXSprite.hpp>
+#include <openvic-simulation/types/OrderedContainers.hpp>
 
+#include "openvic-extension/assets/MaskedFlagCache.hpp"
+#include "openvic-extension/assets/PieChartCache.hpp"
+#include "openvic-extension/assets/ShapedTextCache.hpp"
 #include "openvic-extension/classes/GFXSpriteTexture.hpp"
+#include "openvic-extension/utility/RefCountedCache.hpp"
 
 namespace OpenVic {
 	class AssetManager : public godot::Object {
@@ -20,16 +29,27 @@ namespace OpenVic {
 
 	public:
 		enum LoadFlags {
-			LOAD_FLAG_NONE          = 0,
-			LOAD_FLAG_CACHE_IMAGE   = 1 << 0,
-			LOAD_FLAG_CACHE_TEXTURE = 1 << 1,
-			LOAD_FLAG_FLIP_Y        = 1 << 2
+			LOAD_FLAG_NONE            = 0,
+			LOAD_FLAG_CACHE_IMAGE     = 1 << 0,
+			LOAD_FLAG_CACHE_TEXTURE   = 1 << 1,
+			LOAD_FLAG_FLIP_Y          = 1 << 2,
+			LOAD_FLAG_KEEP_COMPRESSED = 1 << 3
 		};
 
 	private:
 		struct image_asset_t {
+			/* The asset's key in image_assets, so it can be erased when reached through the LRU list. */
+			godot::StringName path;
 			godot::Ref<godot::Image> image;
 			godot::Ref<godot::ImageTexture> texture;
+			int64_t image_bytes = 0;
+			int64_t texture_bytes = 0;
+			/* Neighbours in the intrusive LRU list, ordered from least to most recently used. HashMap elements are never
+			 * moved, so these stay valid until the neighbouring asset is erased (which unlinks it first). */
+			image_asset_t* lru_prev = nullptr;
+			image_asset_t* lru_next = nullptr;
+			/* Pinned assets are never evicted, regardless of the cache budgets. */
+			bool pinned = false;
 		};
 		/* deque_ordered_map to avoid the need to reallocate. */
 		using image_asset_map_t = godot::HashMap<godot::StringName, image_asset_t>;
@@ -38,7 +58,155 @@ namespace OpenVic {
 		image_asset_map_t image_assets;
 		font_map_t fonts;
 
-		static godot::Ref<godot::Image> _load_image(godot::StringName const& path, bool flip_y);
+		static constexpr int64_t DEFAULT_IMAGE_CACHE_BUDGET = 256 * 1024 * 1024;
+		static constexpr int64_t DEFAULT_TEXTURE_CACHE_BUDGET = 512 * 1024 * 1024;
+
+		/* Maximum bytes of CPU-side image data and GPU-side texture data the caches may hold before evicting. Atlas pages
+		 * are never evicted, so don't count towards either, and are reported separately. */
+		int64_t PROPERTY(image_cache_budget, DEFAULT_IMAGE_CACHE_BUDGET);
+		int64_t PROPERTY(texture_cache_budget, DEFAULT_TEXTURE_CACHE_BUDGET);
+		int64_t image_cache_bytes = 0;
+		int64_t texture_cache_bytes = 0;
+
+		/* Least and most recently used ends of the LRU list of assets holding a cached image or texture. */
+		image_asset_t* lru_front = nullptr;
+		image_asset_t* lru_back = nullptr;
+		bool cache_budgets_queued = false;
+
+		uint64_t cache_hits = 0;
+		uint64_t cache_misses = 0;
+		uint64_t image_evictions = 0;
+		uint64_t texture_evictions = 0;
+
+		/* Return the entry for the specified path, creating it if needed. */
+		image_asset_t& _get_image_asset(godot::StringName const& path);
+		/* Unlink the asset from the LRU list and erase it from image_assets. */
+		void _erase_image_asset(image_asset_t& asset);
+		void _unlink_image_asset(image_asset_t& asset);
+		/* Move the asset to the most recently used end of the LRU list, adding it if it isn't already in it. */
+		void _touch_image_asset(image_asset_t& asset);
+		void _cache_image(godot::StringName const& path, godot::Ref<godot::Image> const& image);
+		void _cache_texture(godot::StringName const& path, godot::Ref<godot::ImageTexture> const& texture, int64_t bytes);
+		void _uncache_image(image_asset_t& asset);
+		void _uncache_texture(image_asset_t& asset);
+		/* Budgets are enforced once just before the frame is drawn, rather than after every cache insertion, so assets
+		 * which can't be evicted are only passed over once per frame however many assets are loaded. */
+		void _queue_cache_budget_enforcement();
+		void _enforce_queued_cache_budgets();
+		/* Evict least recently used assets until both caches are within budget. Pinned assets and assets still referenced
+		 * outside the cache are skipped, as evicting them wouldn't free any memory, and are moved to the most recently
+		 * used end of the list as they're still in use. Each asset is visited at most once per call. */
+		void _enforce_cache_budgets();
+
+		/* An asynchronous image load. The lookup is done on the main thread when the request is made, the decoding on a
+		 * WorkerThreadPool thread, and the result is only added to image_assets back on the main thread. */
+		struct image_request_t {
+			godot::StringName path;
+			godot::String lookedup_path;
+			godot::BitField<LoadFlags> load_flags = LOAD_FLAG_NONE;
+			godot::Ref<godot::Image> image;
+			int64_t task_id = -1;
+			bool decoded = false;
+			/* Set by get_requested_image, so the request isn't dropped if it's committed while being redeemed. */
+			bool redeeming = false;
+		};
+		/* Requests are heap allocated so worker threads can hold on to them while new requests are being added. */
+		using image_request_map_t = ordered_map<int64_t, memory::unique_ptr<image_request_t>>;
+
+		/* Guards image_requests, along with the image, decoded and redeeming members of every request in it. */
+		mutable std::mutex image_request_mutex;
+		image_request_map_t image_requests;
+		int64_t next_image_request_ticket = 1;
+		/* Requests are committed to image_assets strictly in ticket order, so the cache ends up in the same state
+		 * regardless of which worker thread finishes first. */
+		int64_t next_image_request_to_commit = 1;
+
+		static godot::StringName const& _signal_image_request_completed();
+		/* RenderingServer signal used to upload dirty atlas pages once per frame. */
+		static godot::StringName const& _signal_frame_pre_draw();
+
+		/* Small GUI images are packed into shared atlas pages to reduce the number of distinct textures (and so texture
+		 * binds and draw calls) needed to draw GUI-heavy screens. Pages are filled left to right in shelves, each as tall
+		 * as the tallest image placed in it. */
+		static constexpr int32_t ATLAS_PAGE_SIZE = 2048;
+		/* Images larger than this in either dimension get their own texture, as packing them would waste page space. */
+		static constexpr int32_t ATLAS_MAX_IMAGE_SIZE = 256;
+		/* Transparent border around each packed image, so filtering never samples a neighbouring image. */
+		static constexpr int32_t ATLAS_PADDING = 1;
+
+		struct atlas_page_t {
+			/* The CPU-side page image is kept so the GPU texture can be updated as more images are added to it. */
+			godot::Ref<godot::Image> image;
+			/* Only created once the first image has been blitted to the page, so it never starts out blank. */
+			godot::Ref<godot::ImageTexture> texture;
+			godot::Vector2i shelf_position;
+			int32_t shelf_height = 0;
+			/* Slots released by pruned button state variants, reused before any new shelf space is allocated. */
+			memory::vector<godot::Rect2i> free_slots;
+			/* Whether images have been blitted to the page since its texture was last updated. */
+			bool dirty = false;
+		};
+		struct atlas_entry_t {
+			/* -1 if the image couldn't be loaded or isn't suitable for packing. */
+			int32_t page_index = -1;
+			godot::Rect2i region;
+			/* The area allocated for the image including its padding, which may be larger than needed if it was a
+			 * reused slot. This is what's returned to the page's free slots if the entry is released. */
+			godot::Rect2i slot;
+		};
+		using atlas_entry_map_t = godot::HashMap<godot::StringName, atlas_entry_t>;
+
+		memory::vector<atlas_page_t> atlas_pages;
+		atlas_entry_map_t atlas_entries;
+		bool atlas_update_queued = false;
+
+		/* Find space for an image of the given size, adding a new page if the current one is full. */
+		atlas_entry_t _allocate_atlas_region(godot::Vector2i const& size);
+		/* Blit an image into a newly allocated atlas region, returning an entry with page_index -1 if the image is
+		 * compressed or too large to pack. */
+		atlas_entry_t _pack_atlas_image(godot::Ref<godot::Image> const& image);
+		/* Return an entry's slot to its page, so it can be reused by later images. */
+		void _release_atlas_region(atlas_entry_t const& entry);
+		int64_t atlas_page_bytes = 0;
+
+		/* Button state variants are generated once per source image region and shared by every texture drawing that
+		 * region, rather than being regenerated for every GFXButtonStateTexture. Source images are identified by a key
+		 * describing their contents, usually the file they were loaded from, so an image that is evicted and reloaded
+		 * still maps to the same variants. */
+		struct button_state_key_t {
+			godot::StringName source_key;
+			godot::Rect2i region;
+			GFXButtonStateTexture::ButtonState button_state;
+
+			bool operator==(button_state_key_t const& other) const = default;
+
+			static uint32_t hash(button_state_key_t const& key);
+		};
+		struct button_state_entry_t {
+			atlas_entry_t atlas_entry;
+			/* Only used for images too large to pack into an atlas page, i.e. when atlas_entry.page_index is -1. */
+			godot::Ref<godot::ImageTexture> texture;
+			/* Held by every texture drawing this variant, so a reference count of 1 means it's no longer in use. Packed
+			 * variants share their page texture with other images, so it can't be used for this. */
+			godot::Ref<godot::RefCounted> users;
+
+			godot::RefCounted const* get_cache_reference() const {
+				return users.ptr();
+			}
+		};
+
+		/* Variants no longer used anywhere else release their atlas page slots when pruned. */
+		RefCountedCache<button_state_key_t, button_state_entry_t, 256> button_state_entries;
+
+		static godot::String _lookup_image(godot::StringName const& path);
+		/* Safe to call from any thread, as it doesn't touch the GameSingleton or any AssetManager state. */
+		static godot::Ref<godot::Image> _decode_image(
+			godot::StringName const& path, godot::String const& lookedup_path, godot::BitField<LoadFlags> load_flags
+		);
+		static godot::Ref<godot::Image> _load_image(godot::StringName const& path, godot::BitField<LoadFlags> load_flags);
+
+		void _decode_image_request(int64_t ticket);
+		void _commit_image_requests();
 
 	protected:
 		static void _bind_methods();
@@ -53,24 +221,103 @@ namespace OpenVic {
 		 * image cache in case it has already been loaded, and returning nullptr if image loading fails. If the cache image
 		 * load flag is set then the loaded image will be stored in the AssetManager's image cache for future access; if the
 		 * flip y load flag is set then the image will be flipped vertically before being returned (if the image is already
-		 * in the cache then no flipping will occur, regardless of whether it was originally flipped or not). */
+		 * in the cache then no flipping will occur, regardless of whether it was originally flipped or not). If the keep
+		 * compressed load flag is set and the image is a DXT compressed ".dds" file, it will be returned compressed
+		 * (unless it also needs flipping) and will not be stored in the image cache, as compressed images can't be read or
+		 * modified pixel by pixel; this is intended for images which are only ever used to create textures. */
 		godot::Ref<godot::Image> get_image(godot::StringName const& path, godot::BitField<LoadFlags> load_flags = LOAD_FLAG_CACHE_IMAGE);
 
+		/* Start loading an image on the WorkerThreadPool, returning a ticket, or -1 if the image cannot be found. The load
+		 * flags behave as in get_image, with cached images completing immediately. Results are added to the image cache on
+		 * the main thread in ticket order, after which the image_request_completed signal is emitted with the ticket, path
+		 * and image (null if it failed to load). The ticket can be redeemed with get_requested_image until then, but is
+		 * forgotten once the signal has been emitted, so unredeemed tickets don't accumulate. */
+		int64_t request_image(godot::StringName const& path, godot::BitField<LoadFlags> load_flags = LOAD_FLAG_CACHE_IMAGE);
+
+		/* Whether the image for the given ticket has finished decoding, in which case get_requested_image won't block.
+		 * This can be true before image_request_completed is emitted, as decoded requests still wait to be committed in
+		 * ticket order, and is false once the ticket has been redeemed or its signal emitted. */
+		bool is_image_request_completed(int64_t ticket) const;
+
+		/* Return the image loaded for the given ticket, waiting for it (and any earlier requests) to finish decoding if
+		 * necessary, and forget the ticket. Returns nullptr if the ticket is unknown, has already been redeemed or had its
+		 * signal emitted, or the image failed to load. */
+		godot::Ref<godot::Image> get_requested_image(int64_t ticket);
+
 		/* Create a texture from an image found at the specified path relative to the game defines, fist checking the
 		 * AssetManager's texture cache in case it has already been loaded, and returning nullptr if image loading or texture
 		 * creation fails. If the cache image load flag is set then the loaded image will be stored in the AssetManager's
 		 * image cache for future access; if the cache texture load flag is set then the created texture will be stored in the
-		 * AssetManager's texture cache for future access; if the flip y load flag is set then the image will be flipped
-		 * vertically before being used to create the texture (if the image is already in the cache then no flipping will
-		 * occur, regardless of whether it was originally flipped or not). */
+		 * AssetManager's texture cache for future access, and unless the cache image load flag is also set (or the path is
+		 * pinned) any cached copy of the image will be dropped; if the flip y load flag is set then the image will be
+		 * flipped vertically before being used to create the texture (if the image is already in the cache then no flipping
+		 * will occur, regardless of whether it was originally flipped or not). */
 		godot::Ref<godot::ImageTexture> get_texture(
 			godot::StringName const& path, godot::BitField<LoadFlags> load_flags = LOAD_FLAG_CACHE_TEXTURE
 		);
 
+		struct atlas_region_t {
+			godot::Ref<godot::Image> page_image;
+			godot::Ref<godot::ImageTexture> page_texture;
+			godot::Rect2i region;
+			/* Only set for button state variants. It must be held for as long as the region is drawn, otherwise the
+			 * variant may be pruned and its region reused for another image. */
+			godot::Ref<godot::RefCounted> users;
+		};
+
+		/* Load the image at the specified path and pack it into a shared atlas page, returning the page and the region
+		 * of it containing the image. Images are only packed once, with later calls returning the same region. If the
+		 * image can't be loaded or is too large to pack, the returned page_texture is null and get_texture should be used
+		 * instead. The page image is fully up to date immediately, while the page texture is updated before the frame is
+		 * drawn. If the path is pinned, the loaded image is also kept in the image cache. */
+		atlas_region_t get_atlas_region(godot::StringName const& path);
+
+		/* Upload all dirty atlas pages to their textures. This happens automatically just before each frame is drawn,
+		 * batched so that multiple images added in the same frame only cause one upload per page, so only needs to be
+		 * called directly before reading a page texture back, e.g. with get_image. */
+		void flush_atlas_pages();
+
+		/* Return the image drawn by the given texture. Regions of atlas pages are copied from the CPU-side page image,
+		 * rather than reading the whole page back from the GPU with get_image. */
+		godot::Ref<godot::Image> get_texture_image(godot::Ref<godot::Texture2D> const& texture) const;
+
+		/* Get the specified button state variant of the given region of source_image, generating it the first time each
+		 * (source key, region, button state) combination is requested and sharing it between all later requests. The
+		 * variant is packed into an atlas page if small enough, otherwise page_image is null and page_texture is a texture
+		 * of its own. The source key must uniquely identify the source image's contents, e.g. the file it was loaded
+		 * from, and so must only be used with images which are never modified or regenerated with different contents,
+		 * at least within the given region, as the cached variant would otherwise go stale. */
+		atlas_region_t get_button_state_region(
+			GFXButtonStateTexture::ButtonState button_state, godot::StringName const& source_key,
+			godot::Ref<godot::Image> const& source_image, godot::Rect2i const& region
+		);
+
+	private:
+		MaskedFlagCache masked_flag_cache;
+		PieChartCache pie_chart_cache;
+		ShapedTextCache shaped_text_cache;
+
+	public:
+		MaskedFlagCache& get_masked_flag_cache();
+		PieChartCache& get_pie_chart_cache();
+		ShapedTextCache& get_shaped_text_cache();
+
 		static godot::Ref<godot::StyleBoxTexture> make_stylebox_texture(
 			godot::Ref<godot::Texture2D> const& texture, godot::Vector2 const& border = {}
 		);
 
+		void set_image_cache_budget(int64_t new_image_cache_budget);
+		void set_texture_cache_budget(int64_t new_texture_cache_budget);
+
+		/* Exempt the image and texture cached for the specified path from eviction, or make them evictable again. */
+		void set_image_pinned(godot::StringName const& path, bool pinned);
+
+		/* Drop every unpinned image and texture from the cache (assets still in use elsewhere stay alive). */
+		void clear_image_cache();
+
+		/* Cache sizes, budgets and hit/miss/eviction counters, packaged in a Dictionary using StringName constants as keys. */
+		godot::Dictionary get_image_cache_stats() const;
+
 		/* Search for and load a font with the specified name from the game defines' font directory, first checking the
 		 * AssetManager's font cache in case it has already been loaded, and returning nullptr if font loading fails. */
 		godot::Ref<godot::FontFile> get_font(godot::StringName const& name);
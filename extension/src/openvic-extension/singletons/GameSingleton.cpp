@@ -103,6 +103,7 @@ GameSingleton* GameSingleton::get_singleton() {
 }
 
 void GameSingleton::_on_gamestate_updated() {
+	gamestate_invalidated();
 	_update_colour_image();
 	emit_signal(_signal_gamestate_updated());
 	gamestate_updated();
@@ -227,6 +228,7 @@ Error GameSingleton::setup_game(int32_t bookmark_index) {
 		province.set_crime(crime_manager.get_crime_modifier_by_index(crime_index));
 	}
 
+	/* Clears the previous session's provinces from the population menu, which is rebuilt once the player's country is set. */
 	ret &= MenuSingleton::get_singleton()->_population_menu_update_provinces() == OK;
 
 	// TODO - replace with actual starting country
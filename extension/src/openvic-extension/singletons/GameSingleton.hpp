@@ -51,6 +51,9 @@ namespace OpenVic {
 	public:
 		static GameSingleton* get_singleton();
 		signal_property<GameSingleton> gamestate_updated;
+		/* Emitted at the start of every gamestate update, before any gamestate_updated handlers (C++ or GDScript) run,
+		 * so caches of values derived from the gamestate can be cleared before anything reads them again. */
+		signal_property<GameSingleton> gamestate_invalidated;
 
 		GameSingleton();
 		~GameSingleton();
@@ -88,41 +88,62 @@ String MenuSingleton::_make_modifier_effects_tooltip(ModifierValue const& modifi
 	return result;
 }
 
+uint32_t MenuSingleton::modifier_contributions_key_t::hash(modifier_contributions_key_t const& key) {
+	uint32_t hash = hash_murmur3_one_64(reinterpret_cast<uintptr_t>(key.modifier_sum));
+	hash = hash_murmur3_one_64(reinterpret_cast<uintptr_t>(key.effect), hash);
+	return hash_fmix32(hash);
+}
+
 template<typename T>
 requires std::same_as<T, CountryInstance> || std::same_as<T, ProvinceInstance>
 String MenuSingleton::_make_modifier_effect_contributions_tooltip(
 	T const& modifier_sum, ModifierEffect const& effect, fixed_point_t* effect_value,
 	String const& prefix, String const& suffix
 ) const {
-	String result;
+	const modifier_contributions_key_t key { &modifier_sum, &effect };
 
-	modifier_sum.for_each_contributing_modifier(
-		effect,
-		[this, &effect, effect_value, &prefix, &suffix, &result](
-			modifier_entry_t const& modifier_entry, fixed_point_t value
-		) -> void {
-			using enum Modifier::modifier_type_t;
+	modifier_contributions_t const* contributions = modifier_contributions_cache.getptr(key);
 
-			if (effect_value != nullptr) {
-				*effect_value += value;
-			}
+	if (contributions == nullptr) {
+		modifier_contributions_t new_contributions;
 
-			result += prefix;
+		modifier_sum.for_each_contributing_modifier(
+			effect,
+			[this, &effect, &new_contributions](modifier_entry_t const& modifier_entry, fixed_point_t value) -> void {
+				new_contributions.total += value;
 
-			if (effect.is_global()) {
-				ProvinceInstance const* province = modifier_entry.get_source_province();
-				if (province != nullptr) {
-					result += tr(GUINode::format_province_name(convert_to<String>(province->get_identifier())));
-					result += ": ";
+				String line;
+
+				if (effect.is_global()) {
+					ProvinceInstance const* province = modifier_entry.get_source_province();
+					if (province != nullptr) {
+						line += tr(GUINode::format_province_name(convert_to<String>(province->get_identifier())));
+						line += ": ";
+					}
 				}
+
+				line += tr(convert_to<String>(modifier_entry.modifier->get_identifier()));
+				line += ": ";
+				line += _make_modifier_effect_value_coloured(effect, value, true);
+
+				new_contributions.lines.push_back(std::move(line));
 			}
+		);
 
-			result += tr(convert_to<String>(modifier_entry.modifier->get_identifier()));
-			result += ": ";
-			result += _make_modifier_effect_value_coloured(effect, value, true);
-			result += suffix;
-		}
-	);
+		contributions = &modifier_contributions_cache.insert(key, std::move(new_contributions))->value;
+	}
+
+	if (effect_value != nullptr) {
+		*effect_value += contributions->total;
+	}
+
+	String result;
+
+	for (String const& line : contributions->lines) {
+		result += prefix;
+		result += line;
+		result += suffix;
+	}
 
 	return result;
 }
@@ -153,15 +174,7 @@ String MenuSingleton::_make_rules_tooltip(RuleSet const& rules) const {
 	return result;
 }
 
-String MenuSingleton::_make_mobilisation_impact_tooltip() const {
-	CountryInstance const* country_ptr = PlayerSingleton::get_singleton()->get_player_country();
-
-	if (country_ptr == nullptr) {
-		return {};
-	}
-
-	CountryInstance const& country = *country_ptr;
-
+String MenuSingleton::_make_mobilisation_impact_tooltip(CountryInstance const& country) const {
 	IssueManager const& issue_manager =
 		GameSingleton::get_singleton()->get_definition_manager().get_politics_manager().get_issue_manager();
 
@@ -205,6 +218,513 @@ String MenuSingleton::_make_mobilisation_impact_tooltip() const {
 	);
 }
 
+String MenuSingleton::_make_research_points_tooltip(CountryInstance const& country) const {
+	ModifierEffectCache const& modifier_effect_cache =
+		GameSingleton::get_singleton()->get_definition_manager().get_modifier_manager().get_modifier_effect_cache();
+
+	String research_points_tooltip;
+
+	fixed_point_t daily_base_research_points;
+
+	for (auto const& [pop_type, research_points] : country.get_research_points_from_pop_types()) {
+		static const StringName pop_type_research_localisation_key = "TECH_DAILY_RESEARCHPOINTS_TOOLTIP";
+		static const String pop_type_replace_key = "$POPTYPE$";
+		static const String fraction_replace_key = "$FRACTION$";
+		static const String optimal_replace_key = "$OPTIMAL$";
+
+		daily_base_research_points += research_points;
+
+		research_points_tooltip += tr(pop_type_research_localisation_key).replace(
+			pop_type_replace_key, tr(convert_to<String>(pop_type->get_identifier()))
+		).replace(
+			Utilities::get_long_value_placeholder(),
+			Utilities::fixed_point_to_string_dp(research_points, 2)
+		).replace(
+			fraction_replace_key, Utilities::fixed_point_to_string_dp(
+				fp::from_fraction(
+					100 * country.get_population_by_type()[pop_type->index],
+					country.get_total_population()
+				), 2
+			)
+		).replace(
+			optimal_replace_key, Utilities::fixed_point_to_string_dp(100 * pop_type->research_leadership_optimum, 2)
+		) + "\n";
+	}
+
+	// Empty prefix, "\n" suffix, fitting with the potential trailing "\n" from the pop type contributions and the upcoming
+	// guaranteed daily base research points line. All contributions are added to daily_base_research_points.
+	research_points_tooltip += _make_modifier_effect_contributions_tooltip(
+		country, *modifier_effect_cache.get_research_points(), &daily_base_research_points, {}, "\n"
+	);
+
+	// The daily base research points line is guaranteed to be present, but those directly above and below it aren't,
+	// so this line has no newline characters of its own. Instead, potential lines above finish with newlines and
+	// potential (and some guaranteed) lines below start with them.
+	static const StringName daily_base_research_points_localisation_key = "TECH_DAILY_RESEARCHPOINTS_BASE_TOOLTIP";
+	research_points_tooltip += tr(daily_base_research_points_localisation_key).replace(
+		Utilities::get_long_value_placeholder(),
+		Utilities::fixed_point_to_string_dp(daily_base_research_points, 2)
+	);
+
+	research_points_tooltip += _make_modifier_effect_contributions_tooltip(
+		country, *modifier_effect_cache.get_research_points_modifier()
+	);
+
+	const fixed_point_t research_points_modifier_from_tech = country.get_modifier_effect_value(
+		*modifier_effect_cache.get_increase_research()
+	);
+	if (research_points_modifier_from_tech != fixed_point_t::_0) {
+		static const StringName from_technology_localisation_key = "FROM_TECHNOLOGY";
+		research_points_tooltip += "\n" + tr(from_technology_localisation_key) + ": " +
+			_make_modifier_effect_value_coloured(
+				*modifier_effect_cache.get_increase_research(), research_points_modifier_from_tech, true
+			);
+	}
+
+	static const StringName daily_research_points_localisation_key = "TECH_DAILY_RESEARCHPOINTS_TOTAL_TOOLTIP";
+	research_points_tooltip += "\n" + tr(daily_research_points_localisation_key).replace(
+		Utilities::get_long_value_placeholder(),
+		Utilities::fixed_point_to_string_dp(country.get_daily_research_points_untracked(), 2)
+	);
+
+	// In the base game this section is only shown when no research is set, but it's useful to show it always
+	research_points_tooltip += "\n" + get_tooltip_separator();
+
+	static const StringName accumulated_research_points_localisation_key = "RP_ACCUMULATED";
+	research_points_tooltip += tr(accumulated_research_points_localisation_key).replace(
+		Utilities::get_short_value_placeholder(),
+		Utilities::fixed_point_to_string_dp(country.get_research_point_stockpile_untracked(), 1)
+	);
+
+	return research_points_tooltip;
+}
+
+String MenuSingleton::_make_leadership_tooltip(CountryInstance const& country) const {
+	DefinitionManager const& definition_manager = GameSingleton::get_singleton()->get_definition_manager();
+	ModifierEffectCache const& modifier_effect_cache = definition_manager.get_modifier_manager().get_modifier_effect_cache();
+
+	String leadership_tooltip;
+
+	fixed_point_t monthly_base_leadership_points;
+
+	for (auto const& [pop_type, leadership_points] : country.get_leadership_points_from_pop_types()) {
+		static const StringName pop_type_leadership_localisation_key = "TECH_DAILY_LEADERSHIP_TOOLTIP";
+		static const String pop_type_replace_key = "$POPTYPE$";
+		static const String fraction_replace_key = "$FRACTION$";
+		static const String optimal_replace_key = "$OPTIMAL$";
+
+		monthly_base_leadership_points += leadership_points;
+
+		leadership_tooltip += tr(pop_type_leadership_localisation_key).replace(
+			pop_type_replace_key, tr(convert_to<String>(pop_type->get_identifier()))
+		).replace(
+			Utilities::get_long_value_placeholder(),
+			Utilities::fixed_point_to_string_dp(leadership_points, 2)
+		).replace(
+			fraction_replace_key, Utilities::fixed_point_to_string_dp(
+				fp::from_fraction(
+					100 * country.get_population_by_type()[pop_type->index],
+					country.get_total_population()
+				), 2
+			)
+		).replace(
+			optimal_replace_key, Utilities::fixed_point_to_string_dp(100 * pop_type->research_leadership_optimum, 2)
+		) + "\n";
+	}
+
+	// Empty prefix, "\n" suffix, fitting with the potential trailing "\n" from the pop type contributions and the upcoming
+	// guaranteed monthly base leadership points line. All contributions are added to monthly_base_leadership_points.
+	leadership_tooltip += _make_modifier_effect_contributions_tooltip(
+		country, *modifier_effect_cache.get_leadership(), &monthly_base_leadership_points, {}, "\n"
+	);
+
+	// The monthly base leadership points line is guaranteed to be present, but those directly above and below it aren't,
+	// so this line has no newline characters of its own. Instead, potential lines above finish with newlines and
+	// potential (and some guaranteed) lines below start with them.
+	static const StringName monthly_base_leadership_localisation_key = "TECH_DAILY_LEADERSHIP_BASE_TOOLTIP";
+	leadership_tooltip += tr(monthly_base_leadership_localisation_key).replace(
+		Utilities::get_long_value_placeholder(),
+		Utilities::fixed_point_to_string_dp(monthly_base_leadership_points, 2)
+	);
+
+	leadership_tooltip += _make_modifier_effect_contributions_tooltip(
+		country, *modifier_effect_cache.get_leadership_modifier()
+	);
+
+	static const StringName monthly_leadership_points_localisation_key = "TECH_DAILY_LEADERSHIP_TOTAL_TOOLTIP";
+	leadership_tooltip += "\n" + tr(monthly_leadership_points_localisation_key).replace(
+		Utilities::get_long_value_placeholder(),
+		Utilities::fixed_point_to_string_dp(country.get_monthly_leadership_points(), 2)
+	);
+
+	const fixed_point_t max_leadership_point_stockpile =
+		definition_manager.get_define_manager().get_military_defines().get_max_leadership_point_stockpile();
+	if (country.get_leadership_point_stockpile() >= max_leadership_point_stockpile) {
+		leadership_tooltip += "\n" + get_tooltip_separator() + "\n";
+
+		static const StringName max_leadership_points_localisation_key = "TOPBAR_LEADERSHIP_MAX";
+		static const String max_replace_key = "$MAX$";
+		leadership_tooltip += tr(max_leadership_points_localisation_key).trim_suffix("\n").replace(
+			max_replace_key, Utilities::fixed_point_to_string_dp(max_leadership_point_stockpile, 1)
+		);
+	}
+
+	return leadership_tooltip;
+}
+
+void MenuSingleton::_make_rgo_tooltips(
+	ProvinceInstance const& province, String& production_tooltip, String& employment_tooltip
+) const {
+	ResourceGatheringOperation const& rgo = province.get_rgo();
+	ERR_FAIL_COND(!rgo.is_valid());
+
+	ProductionType const& production_type = *rgo.get_production_type_nullable();
+	GoodDefinition const& rgo_good = *province.get_rgo_good();
+	TerrainType const* terrain_type = province.get_terrain_type();
+	const pop_size_t max_employee_count = rgo.get_max_employee_count_cache();
+
+	ModifierEffectCache const& modifier_effect_cache =
+		GameSingleton::get_singleton()->get_definition_manager().get_modifier_manager().get_modifier_effect_cache();
+
+	fixed_point_t output_from_workers = 1, throughput_from_workers = 0,
+		output_multiplier = 1, throughput_multiplier = 1;
+	String size_string, output_string, throughput_string;
+
+	static const String employee_effect_template_string = "\n  -%s: " + GUILabel::get_colour_marker() + "Y%s" +
+		GUILabel::get_colour_marker() + "!: %s";
+
+	using enum Job::effect_t;
+
+	std::optional<Job> const& owner_job = production_type.owner;
+	if (owner_job.has_value()) {
+		const pop_type_index_t owner_pop_type_index = owner_job->pop_type_index;
+		PopType const& owner_pop_type = GameSingleton::get_singleton()->get_pop_type(owner_pop_type_index);
+		State const* state = province.get_state();
+
+		if (unlikely(state == nullptr)) {
+			spdlog::error_s(
+				"Province \"{}\" has no state, preventing calculation of state-wide population proportion of RGO owner pop type \"{}\"",
+				province, owner_pop_type
+			);
+		} else {
+			const fixed_point_t effect_value = state->get_total_population() == 0
+				? fixed_point_t::_0
+				: fp::mul_div(
+					owner_job->effect_multiplier,
+					state->get_population_by_type()[owner_pop_type_index],
+					state->get_total_population()
+				);
+
+			static const StringName owners_localisation_key = "PRODUCTION_FACTOR_OWNER";
+
+			switch (owner_job->effect_type) {
+			case OUTPUT:
+				output_multiplier += effect_value;
+				output_string += Utilities::format(
+					employee_effect_template_string,
+					tr(owners_localisation_key),
+					tr(convert_to<String>(owner_pop_type.get_identifier())),
+					_make_modifier_effect_value_coloured(
+						*modifier_effect_cache.get_rgo_output_country(), effect_value, true
+					)
+				);
+				break;
+			case THROUGHPUT:
+				throughput_multiplier += effect_value;
+				throughput_string += Utilities::format(
+					employee_effect_template_string,
+					tr(owners_localisation_key),
+					tr(convert_to<String>(owner_pop_type.get_identifier())),
+					_make_modifier_effect_value_coloured(
+						*modifier_effect_cache.get_rgo_throughput_country(), effect_value, true
+					)
+				);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	String amount_of_employees_by_pop_type;
+
+	for (pop_type_index_t pop_type_index {}; pop_type_index < rgo.get_employee_count_per_type_cache().size(); ++pop_type_index) {
+		const pop_size_t employees_of_type = rgo.get_employee_count_per_type_cache()[pop_type_index];
+		if (employees_of_type <= 0) {
+			continue;
+		}
+
+		static const String amount_of_employees_by_pop_type_template_string = "\n  -" + GUILabel::get_colour_marker() +
+			"Y%s" + GUILabel::get_colour_marker() + "!:%d";
+
+		PopType const& pop_type = GameSingleton::get_singleton()->get_pop_type(pop_type_index);
+		amount_of_employees_by_pop_type += Utilities::format(
+			amount_of_employees_by_pop_type_template_string,
+			tr(convert_to<String>(pop_type.get_identifier())),
+			type_safe::get(employees_of_type)
+		);
+
+		for (Job const& job : production_type.get_jobs()) {
+			if (job.pop_type_index != pop_type_index) {
+				continue;
+			}
+
+			const fixed_point_t effect_multiplier = job.effect_multiplier;
+			fixed_point_t relative_to_workforce = fp::from_fraction(employees_of_type, max_employee_count);
+			const fixed_point_t effect_value = effect_multiplier == fixed_point_t::_1
+				? relative_to_workforce
+				: effect_multiplier * std::min(relative_to_workforce, job.amount);
+
+			static const StringName workers_localisation_key = "PRODUCTION_FACTOR_WORKER";
+
+			switch (job.effect_type) {
+				case OUTPUT:
+					output_from_workers += effect_value;
+					output_string += Utilities::format(
+						employee_effect_template_string,
+						tr(workers_localisation_key),
+						tr(convert_to<String>(pop_type.get_identifier())),
+						_make_modifier_effect_value_coloured(
+							*modifier_effect_cache.get_rgo_output_country(), effect_value, true
+						)
+					);
+					break;
+				case THROUGHPUT:
+					throughput_from_workers += effect_value;
+					throughput_string += Utilities::format(
+						employee_effect_template_string,
+						tr(workers_localisation_key),
+						tr(convert_to<String>(pop_type.get_identifier())),
+						_make_modifier_effect_value_coloured(
+							*modifier_effect_cache.get_rgo_throughput_country(), effect_value, true
+						)
+					);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	{
+		String output_modifiers, throughput_modifiers;
+
+		static const String modifier_effect_contributions_prefix = "\n  -";
+
+		output_modifiers += _make_modifier_effect_contributions_tooltip(
+			province, *modifier_effect_cache.get_rgo_output_country(), &output_multiplier,
+			modifier_effect_contributions_prefix
+		);
+		output_modifiers += _make_modifier_effect_contributions_tooltip(
+			province, *modifier_effect_cache.get_local_rgo_output(), &output_multiplier,
+			modifier_effect_contributions_prefix
+		);
+		throughput_modifiers += _make_modifier_effect_contributions_tooltip(
+			province, *modifier_effect_cache.get_rgo_throughput_country(), &throughput_multiplier,
+			modifier_effect_contributions_prefix
+		);
+		throughput_modifiers += _make_modifier_effect_contributions_tooltip(
+			province, *modifier_effect_cache.get_local_rgo_throughput(), &throughput_multiplier,
+			modifier_effect_contributions_prefix
+		);
+
+		fixed_point_t size_from_terrain, size_from_province;
+
+		if (production_type.get_is_farm_for_non_tech()) {
+			output_modifiers += _make_modifier_effect_contributions_tooltip(
+				province, *modifier_effect_cache.get_farm_rgo_output_global(), &output_multiplier,
+				modifier_effect_contributions_prefix
+			);
+			output_modifiers += _make_modifier_effect_contributions_tooltip(
+				province, *modifier_effect_cache.get_farm_rgo_output_local(), &output_multiplier,
+				modifier_effect_contributions_prefix
+			);
+
+			if (terrain_type != nullptr) {
+				size_from_terrain = terrain_type->get_effect(*modifier_effect_cache.get_farm_rgo_size_local());
+			}
+			size_from_province = province.get_modifier_effect_value(*modifier_effect_cache.get_farm_rgo_size_local());
+		}
+
+		if (production_type.get_is_mine_for_non_tech()) {
+			output_modifiers += _make_modifier_effect_contributions_tooltip(
+				province, *modifier_effect_cache.get_mine_rgo_output_global(), &output_multiplier,
+				modifier_effect_contributions_prefix
+			);
+			output_modifiers += _make_modifier_effect_contributions_tooltip(
+				province, *modifier_effect_cache.get_mine_rgo_output_local(), &output_multiplier,
+				modifier_effect_contributions_prefix
+			);
+
+			if (terrain_type != nullptr) {
+				size_from_terrain += terrain_type->get_effect(*modifier_effect_cache.get_mine_rgo_size_local());
+			}
+			size_from_province += province.get_modifier_effect_value(*modifier_effect_cache.get_mine_rgo_size_local());
+		}
+
+		static const String size_modifier_template_string = "%s: %s\n";
+
+		if (size_from_terrain != fixed_point_t::_0) {
+			size_string = Utilities::format(
+				size_modifier_template_string,
+				tr(convert_to<String>(province.get_terrain_type()->get_identifier())),
+				_make_modifier_effect_value_coloured(
+					*modifier_effect_cache.get_farm_rgo_size_local(), size_from_terrain, false
+				)
+			);
+		}
+
+		if (size_from_province != fixed_point_t::_0) {
+			static const StringName rgo_size_localisation_key = "RGO_SIZE";
+
+			size_string += Utilities::format(
+				size_modifier_template_string,
+				tr(rgo_size_localisation_key),
+				_make_modifier_effect_value_coloured(
+					*modifier_effect_cache.get_farm_rgo_size_local(), size_from_province, false
+				)
+			);
+		}
+
+		ModifierEffectCache::good_effects_t const& good_effects =
+			modifier_effect_cache.get_good_effects(production_type.output_good);
+
+		fixed_point_t output_from_tech =
+			province.get_modifier_effect_value(*modifier_effect_cache.get_rgo_output_tech()) +
+			province.get_modifier_effect_value(*good_effects.get_rgo_goods_output());
+		fixed_point_t throughput_from_tech =
+			province.get_modifier_effect_value(*modifier_effect_cache.get_rgo_throughput_tech()) +
+			province.get_modifier_effect_value(*good_effects.get_rgo_goods_throughput());
+
+		fixed_point_t size_from_tech;
+
+		size_from_tech = province.get_modifier_effect_value(*good_effects.get_rgo_size());
+		if (production_type.get_is_farm_for_tech()) {
+			const fixed_point_t value =
+				province.get_modifier_effect_value(*modifier_effect_cache.get_farm_rgo_throughput_and_output());
+			output_from_tech += value;
+			throughput_from_tech += value;
+
+			size_from_tech += province.get_modifier_effect_value(*modifier_effect_cache.get_farm_rgo_size_global());
+		}
+
+		if (production_type.get_is_mine_for_tech()) {
+			const fixed_point_t value =
+				province.get_modifier_effect_value(*modifier_effect_cache.get_mine_rgo_throughput_and_output());
+			output_from_tech += value;
+			throughput_from_tech += value;
+
+			size_from_tech += province.get_modifier_effect_value(*modifier_effect_cache.get_mine_rgo_size_global());
+		}
+
+		if (size_from_tech != fixed_point_t::_0) {
+			static const StringName from_technology_localisation_key = "employ_from_tech";
+
+			size_string += tr(from_technology_localisation_key) + _make_modifier_effect_value_coloured(
+				*modifier_effect_cache.get_farm_rgo_size_global(), size_from_tech, false
+			);
+		}
+
+		static const String tech_modifier_template_string = modifier_effect_contributions_prefix + String { "%s: %s" };
+
+		if (output_from_tech != fixed_point_t::_0) {
+			output_multiplier += output_from_tech;
+
+			static const StringName rgo_output_tech_localisation_key = "RGO_OUTPUT_TECH";
+
+			output_string += Utilities::format(
+				tech_modifier_template_string,
+				tr(rgo_output_tech_localisation_key),
+				_make_modifier_effect_value_coloured(
+					*modifier_effect_cache.get_rgo_output_tech(), output_from_tech, true
+				)
+			);
+		}
+
+		if (throughput_from_tech != fixed_point_t::_0) {
+			throughput_multiplier += throughput_from_tech;
+
+			static const StringName rgo_throughput_tech_localisation_key = "RGO_THROUGHPUT_TECH";
+
+			throughput_string += Utilities::format(
+				tech_modifier_template_string,
+				tr(rgo_throughput_tech_localisation_key),
+				_make_modifier_effect_value_coloured(
+					*modifier_effect_cache.get_rgo_throughput_tech(), throughput_from_tech, true
+				)
+			);
+		}
+
+		output_string += output_modifiers;
+		throughput_string += throughput_modifiers;
+	}
+
+	static const StringName rgo_production_localisation_key = "PROVINCEVIEW_GOODSINCOME";
+	static const String rgo_good_replace_key = "$GOODS$";
+	static const StringName max_output_localisation_key = "PRODUCTION_OUTPUT_GOODS_TOOLTIP2";
+	static const String curr_replace_key = "$CURR$";
+	static const StringName output_explanation_localisation_key = "PRODUCTION_OUTPUT_EXPLANATION";
+	static const StringName base_output_localisation_key = "PRODUCTION_BASE_OUTPUT_GOODS_TOOLTIP";
+	static const String base_replace_key = "$BASE$";
+	static const StringName output_efficiency_localisation_key = "PRODUCTION_OUTPUT_EFFICIENCY_TOOLTIP";
+	static const StringName base_localisation_key = "PRODUCTION_BASE_OUTPUT";
+	static const StringName throughput_efficiency_localisation_key = "PRODUCTION_THROUGHPUT_EFFICIENCY_TOOLTIP";
+	static const String rgo_production_template_string = "%s\n%s%s" + get_tooltip_separator() + "%s%s%s\n%s " +
+		GUILabel::get_colour_marker() + "G100%%" + GUILabel::get_colour_marker() + "!%s\n\n%s%s%s";
+
+	const fixed_point_t throughput_efficiency = throughput_from_workers * throughput_multiplier;
+	const fixed_point_t output_efficiency = output_from_workers * output_multiplier;
+	const fixed_point_t base_output = production_type.base_output_quantity;
+	const fixed_point_t max_output = base_output * throughput_efficiency * output_efficiency;
+
+	production_tooltip = Utilities::format(
+		rgo_production_template_string,
+		tr(rgo_production_localisation_key).replace(
+			rgo_good_replace_key, tr(convert_to<String>(rgo_good.get_identifier()))
+		).replace(
+			Utilities::get_long_value_placeholder(),
+			Utilities::fixed_point_to_string_dp(rgo.get_revenue_yesterday(), 3)
+		),
+		tr(max_output_localisation_key).replace(curr_replace_key, Utilities::fixed_point_to_string_dp(max_output, 2)),
+		tr(output_explanation_localisation_key),
+		tr(base_output_localisation_key).replace(base_replace_key, Utilities::fixed_point_to_string_dp(base_output, 2)),
+		tr(output_efficiency_localisation_key),
+		_make_modifier_effect_value_coloured(*modifier_effect_cache.get_rgo_output_country(), output_efficiency, false),
+		tr(base_localisation_key),
+		output_string,
+		tr(throughput_efficiency_localisation_key),
+		_make_modifier_effect_value_coloured(
+			*modifier_effect_cache.get_rgo_throughput_country(), throughput_efficiency, false
+		),
+		throughput_string
+	);
+
+	static const StringName employment_localisation_key = "PROVINCEVIEW_EMPLOYMENT";
+	static const StringName employee_count_localisation_key = "PRODUCTION_FACTORY_EMPLOYEECOUNT_TOOLTIP2";
+	static const String employee_replace_key = "$EMPLOYEES$";
+	static const String employee_max_replace_key = "$EMPLOYEE_MAX$";
+	static const StringName rgo_workforce_localisation_key = "BASE_RGO_SIZE";
+	static const StringName province_size_localisation_key = "FROM_PROV_SIZE";
+	static const String rgo_employment_template_string = "%s" + get_tooltip_separator() + "%s%s\n%s%d\n%s\n%s" +
+		GUILabel::get_colour_marker() + "G%d";
+
+	employment_tooltip = Utilities::format(
+		rgo_employment_template_string,
+		tr(employment_localisation_key).replace(Utilities::get_long_value_placeholder(), {}),
+		tr(employee_count_localisation_key).replace(
+			employee_replace_key, String::num_int64(type_safe::get(rgo.get_total_employees_count_cache()))
+		).replace(
+			employee_max_replace_key, String::num_int64(type_safe::get(rgo.get_max_employee_count_cache()))
+		),
+		amount_of_employees_by_pop_type,
+		tr(rgo_workforce_localisation_key),
+		type_safe::get(production_type.base_workforce_size),
+		size_string,
+		tr(province_size_localisation_key),
+		static_cast<int32_t>(rgo.get_size_multiplier()) // TODO - remove cast once variable is an int32_t
+	);
+}
+
 void MenuSingleton::_bind_methods() {
 	OV_BIND_SMETHOD(get_tooltip_separator);
 	OV_BIND_METHOD(MenuSingleton::get_country_name_from_identifier, { "country_identifier" });
@@ -214,6 +734,12 @@ void MenuSingleton::_bind_methods() {
 	OV_BIND_METHOD(MenuSingleton::show_tooltip, { "text", "substitution_dict", "position" });
 	OV_BIND_METHOD(MenuSingleton::show_control_tooltip, { "text", "substitution_dict", "control" });
 	OV_BIND_METHOD(MenuSingleton::hide_tooltip);
+	OV_BIND_SMETHOD(make_tooltip_id, { "kind", "target" });
+	OV_BIND_SMETHOD(get_provided_tooltip_placeholder);
+	OV_BIND_METHOD(MenuSingleton::get_tooltip_text, { "tooltip_id" });
+	OV_BIND_METHOD(
+		MenuSingleton::show_control_provided_tooltip, { "tooltip_id", "text", "substitution_dict", "control" }
+	);
 
 	ADD_SIGNAL(MethodInfo(
 		_signal_update_tooltip(), PropertyInfo(Variant::STRING, "text"),
@@ -252,6 +778,7 @@ void MenuSingleton::_bind_methods() {
 	OV_BIND_METHOD(MenuSingleton::population_menu_update_locale_sort_cache);
 	OV_BIND_METHOD(MenuSingleton::population_menu_select_sort_key, { "sort_key" });
 	OV_BIND_METHOD(MenuSingleton::get_population_menu_pop_rows, { "start", "count" });
+	OV_BIND_METHOD(MenuSingleton::get_population_menu_pop_columns, { "start", "count" });
 	OV_BIND_METHOD(MenuSingleton::get_population_menu_pop_row_count);
 
 	OV_BIND_METHOD(MenuSingleton::get_population_menu_pop_filter_setup_info);
@@ -263,12 +790,34 @@ void MenuSingleton::_bind_methods() {
 	OV_BIND_METHOD(MenuSingleton::get_population_menu_distribution_setup_info);
 	OV_BIND_METHOD(MenuSingleton::get_population_menu_distribution_info);
 
+	OV_BIND_METHOD(MenuSingleton::population_menu_refresh);
+	OV_BIND_METHOD(MenuSingleton::get_population_menu_refresh_timings);
+
 	ADD_SIGNAL(MethodInfo(_signal_population_menu_province_list_changed()));
 	ADD_SIGNAL(
 		MethodInfo(_signal_population_menu_province_list_selected_changed(), PropertyInfo(Variant::INT, "scroll_index"))
 	);
 	ADD_SIGNAL(MethodInfo(_signal_population_menu_pops_changed()));
 
+	BIND_ENUM_CONSTANT(TOOLTIP_NONE);
+	BIND_ENUM_CONSTANT(TOOLTIP_MOBILISATION_IMPACT);
+	BIND_ENUM_CONSTANT(TOOLTIP_RESEARCH_POINTS);
+	BIND_ENUM_CONSTANT(TOOLTIP_LEADERSHIP);
+	BIND_ENUM_CONSTANT(TOOLTIP_RGO_PRODUCTION);
+	BIND_ENUM_CONSTANT(TOOLTIP_RGO_EMPLOYMENT);
+	BIND_ENUM_CONSTANT(TOOLTIP_GOOD_TOP_PRODUCERS);
+	BIND_ENUM_CONSTANT(TOOLTIP_WAR_EXHAUSTION);
+	BIND_ENUM_CONSTANT(TOOLTIP_SUPPLY_CONSUMPTION);
+	BIND_ENUM_CONSTANT(TOOLTIP_ORGANISATION_REGAIN);
+	BIND_ENUM_CONSTANT(TOOLTIP_LAND_ORGANISATION);
+	BIND_ENUM_CONSTANT(TOOLTIP_NAVAL_ORGANISATION);
+	BIND_ENUM_CONSTANT(TOOLTIP_UNIT_START_EXPERIENCE);
+	BIND_ENUM_CONSTANT(TOOLTIP_RECRUIT_TIME);
+	BIND_ENUM_CONSTANT(TOOLTIP_COMBAT_WIDTH);
+	BIND_ENUM_CONSTANT(TOOLTIP_MOBILISATION_SIZE);
+	BIND_ENUM_CONSTANT(TOOLTIP_MOBILISE);
+	BIND_ENUM_CONSTANT(TOOLTIP_MOBILISATION_ECONOMY_IMPACT);
+
 	BIND_ENUM_CONSTANT(LIST_ENTRY_NONE);
 	BIND_ENUM_CONSTANT(LIST_ENTRY_COUNTRY);
 	BIND_ENUM_CONSTANT(LIST_ENTRY_STATE);
@@ -328,11 +877,62 @@ MenuSingleton* MenuSingleton::get_singleton() {
 MenuSingleton::MenuSingleton() {
 	ERR_FAIL_COND(singleton != nullptr);
 	singleton = this;
+
+	GameSingleton* game_singleton = GameSingleton::get_singleton();
+	ERR_FAIL_NULL(game_singleton);
+	game_singleton->gamestate_invalidated.connect(&MenuSingleton::_on_gamestate_invalidated, this);
+
+	PlayerSingleton* player_singleton = PlayerSingleton::get_singleton();
+	ERR_FAIL_NULL(player_singleton);
+	player_singleton->player_country_changed.connect(&MenuSingleton::_on_player_country_changed, this);
 }
 
 MenuSingleton::~MenuSingleton() {
 	ERR_FAIL_COND(singleton != this);
 	singleton = nullptr;
+
+	/* If the GameSingleton has already been destroyed then so has the connection. */
+	GameSingleton* game_singleton = GameSingleton::get_singleton();
+	if (game_singleton != nullptr) {
+		game_singleton->gamestate_invalidated.disconnect(&MenuSingleton::_on_gamestate_invalidated, this);
+	}
+
+	PlayerSingleton* player_singleton = PlayerSingleton::get_singleton();
+	if (player_singleton != nullptr) {
+		player_singleton->player_country_changed.disconnect(&MenuSingleton::_on_player_country_changed, this);
+	}
+}
+
+void MenuSingleton::_on_gamestate_invalidated() {
+	clear_tooltip_cache();
+}
+
+void MenuSingleton::_on_player_country_changed() {
+	/* The population menu's province list is made from the player's country. */
+	ERR_FAIL_COND(_population_menu_update_provinces() != OK);
+}
+
+void MenuSingleton::_refresh_provided_tooltip() {
+	if (provided_tooltip.tooltip_id == 0) {
+		return;
+	}
+
+	Control const* control = Object::cast_to<Control>(ObjectDB::get_instance(provided_tooltip.control_id));
+	if (control == nullptr || !control->is_inside_tree()) {
+		provided_tooltip = {};
+		return;
+	}
+
+	/* Copied, as showing the tooltip again overwrites provided_tooltip. */
+	const provided_tooltip_t shown_tooltip = provided_tooltip;
+	show_control_provided_tooltip(shown_tooltip.tooltip_id, shown_tooltip.text, shown_tooltip.substitution_dict, control);
+}
+
+void MenuSingleton::clear_tooltip_cache() {
+	tooltip_cache.clear();
+	/* Contribution lines include translated modifier and province names, so go stale along with the tooltips. */
+	modifier_contributions_cache.clear();
+	_refresh_provided_tooltip();
 }
 
 String MenuSingleton::get_issue_identifier_suffix() {
@@ -386,6 +986,8 @@ String MenuSingleton::get_country_adjective_from_identifier(String const& countr
 /* TOOLTIP */
 
 void MenuSingleton::show_tooltip(String const& text, Dictionary const& substitution_dict, Vector2 const& position) {
+	/* Any other tooltip replaces the provided one, which show_control_provided_tooltip sets again afterwards. */
+	provided_tooltip = {};
 	emit_signal(_signal_update_tooltip(), text, substitution_dict, position);
 }
 
@@ -402,6 +1004,116 @@ void MenuSingleton::hide_tooltip() {
 	show_tooltip({}, {}, {});
 }
 
+int64_t MenuSingleton::make_tooltip_id(TooltipKind kind, int32_t target) {
+	return (static_cast<int64_t>(kind) << 32) | static_cast<uint32_t>(target);
+}
+
+String MenuSingleton::get_provided_tooltip_placeholder() {
+	static const String provided_tooltip_placeholder = "$PROVIDED_TOOLTIP$";
+	return provided_tooltip_placeholder;
+}
+
+String MenuSingleton::get_tooltip_text(int64_t tooltip_id) {
+	const decltype(tooltip_cache)::const_iterator it = tooltip_cache.find(tooltip_id);
+	if (it != tooltip_cache.end()) {
+		return it->second;
+	}
+
+	const TooltipKind kind = static_cast<TooltipKind>(tooltip_id >> 32);
+	const int32_t target = static_cast<int32_t>(tooltip_id & 0xFFFFFFFF);
+
+	InstanceManager const* instance_manager = GameSingleton::get_singleton()->get_instance_manager();
+	ERR_FAIL_NULL_V(instance_manager, {});
+
+	String text;
+
+	switch (kind) {
+	case TOOLTIP_MOBILISATION_IMPACT:
+	case TOOLTIP_RESEARCH_POINTS:
+	case TOOLTIP_LEADERSHIP:
+	case TOOLTIP_WAR_EXHAUSTION:
+	case TOOLTIP_SUPPLY_CONSUMPTION:
+	case TOOLTIP_ORGANISATION_REGAIN:
+	case TOOLTIP_LAND_ORGANISATION:
+	case TOOLTIP_NAVAL_ORGANISATION:
+	case TOOLTIP_UNIT_START_EXPERIENCE:
+	case TOOLTIP_RECRUIT_TIME:
+	case TOOLTIP_COMBAT_WIDTH:
+	case TOOLTIP_MOBILISATION_SIZE:
+	case TOOLTIP_MOBILISE:
+	case TOOLTIP_MOBILISATION_ECONOMY_IMPACT: {
+		/* get_country_instance_by_index doesn't check the index, so it must be checked here. */
+		const std::span<const CountryInstance> countries =
+			instance_manager->get_country_instance_manager().get_country_instances();
+		ERR_FAIL_INDEX_V(target, countries.size(), {});
+		CountryInstance const& country = countries[target];
+
+		if (kind == TOOLTIP_MOBILISATION_IMPACT) {
+			text = _make_mobilisation_impact_tooltip(country);
+		} else if (kind == TOOLTIP_RESEARCH_POINTS) {
+			text = _make_research_points_tooltip(country);
+		} else if (kind == TOOLTIP_LEADERSHIP) {
+			text = _make_leadership_tooltip(country);
+		} else {
+			text = _make_military_stat_tooltip(kind, country);
+		}
+		break;
+	}
+	case TOOLTIP_RGO_PRODUCTION:
+	case TOOLTIP_RGO_EMPLOYMENT: {
+		ProvinceInstance const* province = instance_manager->get_map_instance().get_province_instance_from_number(target);
+		ERR_FAIL_NULL_V(province, {});
+		ERR_FAIL_COND_V(!province->get_rgo().is_valid(), {});
+
+		/* Both RGO tooltips are built from the same breakdown, so generate and cache them together. */
+		String production_tooltip, employment_tooltip;
+		_make_rgo_tooltips(*province, production_tooltip, employment_tooltip);
+
+		text = kind == TOOLTIP_RGO_PRODUCTION ? production_tooltip : employment_tooltip;
+		tooltip_cache.emplace(make_tooltip_id(TOOLTIP_RGO_PRODUCTION, target), std::move(production_tooltip));
+		tooltip_cache.emplace(make_tooltip_id(TOOLTIP_RGO_EMPLOYMENT, target), std::move(employment_tooltip));
+		return text;
+	}
+	case TOOLTIP_GOOD_TOP_PRODUCERS: {
+		ERR_FAIL_INDEX_V(
+			target, GameSingleton::get_singleton()->get_definition_manager().get_economy_manager()
+				.get_good_definition_manager().get_good_definition_count(), {}
+		);
+		GoodInstance const* good =
+			instance_manager->get_good_instance_manager().get_good_instance_by_index(good_index_t(target));
+		ERR_FAIL_NULL_V(good, {});
+
+		text = _make_good_top_producers_tooltip(*good);
+		break;
+	}
+	default:
+		ERR_FAIL_V_MSG({}, Utilities::format("Invalid tooltip ID: %d", tooltip_id));
+	}
+
+	tooltip_cache.emplace(tooltip_id, text);
+
+	return text;
+}
+
+void MenuSingleton::show_control_provided_tooltip(
+	int64_t tooltip_id, String const& text, Dictionary const& substitution_dict, Control const* control
+) {
+	ERR_FAIL_NULL(control);
+
+	if (text.is_empty()) {
+		show_control_tooltip(get_tooltip_text(tooltip_id), substitution_dict, control);
+	} else {
+		static const String provided_tooltip_key = "PROVIDED_TOOLTIP";
+
+		Dictionary provided_substitution_dict = substitution_dict.duplicate();
+		provided_substitution_dict[provided_tooltip_key] = get_tooltip_text(tooltip_id);
+
+		show_control_tooltip(text, provided_substitution_dict, control);
+	}
+
+	provided_tooltip = { tooltip_id, text, substitution_dict, control->get_instance_id() };
+}
+
 /* PROVINCE OVERVIEW PANEL */
 
 static TypedArray<Dictionary> _make_buildings_dict_array(
@@ -462,10 +1174,10 @@ Dictionary MenuSingleton::get_province_info_from_number(int32_t province_number)
 	static const StringName province_info_controller_key = "controller";
 	static const StringName province_info_controller_tooltip_key = "controller_tooltip";
 	static const StringName province_info_rgo_icon_key = "rgo_icon";
-	static const StringName province_info_rgo_production_tooltip_key = "rgo_production_tooltip";
+	static const StringName province_info_rgo_production_tooltip_id_key = "rgo_production_tooltip_id";
 	static const StringName province_info_rgo_total_employees_key = "rgo_total_employees";
 	static const StringName province_info_rgo_employment_percentage_key = "rgo_employment_percentage";
-	static const StringName province_info_rgo_employment_tooltip_key = "rgo_employment_tooltip";
+	static const StringName province_info_rgo_employment_tooltip_id_key = "rgo_employment_tooltip_id";
 	static const StringName province_info_rgo_output_quantity_yesterday_key = "rgo_output_quantity_yesterday";
 	static const StringName province_info_rgo_revenue_yesterday_key = "rgo_revenue_yesterday";
 	static const StringName province_info_crime_name_key = "crime_name";
@@ -533,7 +1245,6 @@ Dictionary MenuSingleton::get_province_info_from_number(int32_t province_number)
 	ResourceGatheringOperation const& rgo = province->get_rgo();
 
 	if (rgo.is_valid()) {
-		ProductionType const& production_type = *rgo.get_production_type_nullable();
 		GoodDefinition const& rgo_good = *province->get_rgo_good();
 
 		ret[province_info_rgo_icon_key] = static_cast<uint64_t>(type_safe::get(rgo_good.index));
@@ -549,346 +1260,8 @@ Dictionary MenuSingleton::get_province_info_from_number(int32_t province_number)
 				static_cast<real_t>(rgo.get_total_employees_count_cache() * fixed_point_t::_100 / max_employee_count);
 		}
 
-		ModifierEffectCache const& modifier_effect_cache =
-			game_singleton->get_definition_manager().get_modifier_manager().get_modifier_effect_cache();
-
-		fixed_point_t output_from_workers = 1, throughput_from_workers = 0,
-			output_multiplier = 1, throughput_multiplier = 1;
-		String size_string, output_string, throughput_string;
-
-		static const String employee_effect_template_string = "\n  -%s: " + GUILabel::get_colour_marker() + "Y%s" +
-			GUILabel::get_colour_marker() + "!: %s";
-
-		using enum Job::effect_t;
-
-		std::optional<Job> const& owner_job = production_type.owner;
-		if (owner_job.has_value()) {
-			const pop_type_index_t owner_pop_type_index = owner_job->pop_type_index;
-			PopType const& owner_pop_type = GameSingleton::get_singleton()->get_pop_type(owner_pop_type_index);
-			State const* state = province->get_state();
-
-			if (unlikely(state == nullptr)) {
-				spdlog::error_s(
-					"Province \"{}\" has no state, preventing calculation of state-wide population proportion of RGO owner pop type \"{}\"",
-					*province, owner_pop_type
-				);
-			} else {
-				const fixed_point_t effect_value = state->get_total_population() == 0
-					? fixed_point_t::_0
-					: fp::mul_div(
-						owner_job->effect_multiplier,
-						state->get_population_by_type()[owner_pop_type_index],
-						state->get_total_population()
-					);
-
-				static const StringName owners_localisation_key = "PRODUCTION_FACTOR_OWNER";
-
-				switch (owner_job->effect_type) {
-				case OUTPUT:
-					output_multiplier += effect_value;
-					output_string += Utilities::format(
-						employee_effect_template_string,
-						tr(owners_localisation_key),
-						tr(convert_to<String>(owner_pop_type.get_identifier())),
-						_make_modifier_effect_value_coloured(
-							*modifier_effect_cache.get_rgo_output_country(), effect_value, true
-						)
-					);
-					break;
-				case THROUGHPUT:
-					throughput_multiplier += effect_value;
-					throughput_string += Utilities::format(
-						employee_effect_template_string,
-						tr(owners_localisation_key),
-						tr(convert_to<String>(owner_pop_type.get_identifier())),
-						_make_modifier_effect_value_coloured(
-							*modifier_effect_cache.get_rgo_throughput_country(), effect_value, true
-						)
-					);
-					break;
-				default:
-					break;
-				}
-			}
-		}
-
-		String amount_of_employees_by_pop_type;
-
-		for (pop_type_index_t pop_type_index {}; pop_type_index < rgo.get_employee_count_per_type_cache().size(); ++pop_type_index) {
-			const pop_size_t employees_of_type = rgo.get_employee_count_per_type_cache()[pop_type_index];
-			if (employees_of_type <= 0) {
-				continue;
-			}
-
-			static const String amount_of_employees_by_pop_type_template_string = "\n  -" + GUILabel::get_colour_marker() +
-				"Y%s" + GUILabel::get_colour_marker() + "!:%d";
-
-			PopType const& pop_type = GameSingleton::get_singleton()->get_pop_type(pop_type_index);
-			amount_of_employees_by_pop_type += Utilities::format(
-				amount_of_employees_by_pop_type_template_string,
-				tr(convert_to<String>(pop_type.get_identifier())),
-				type_safe::get(employees_of_type)
-			);
-
-			for (Job const& job : production_type.get_jobs()) {
-				if (job.pop_type_index != pop_type_index) {
-					continue;
-				}
-
-				const fixed_point_t effect_multiplier = job.effect_multiplier;
-				fixed_point_t relative_to_workforce = fp::from_fraction(employees_of_type, max_employee_count);
-				const fixed_point_t effect_value = effect_multiplier == fixed_point_t::_1
-					? relative_to_workforce
-					: effect_multiplier * std::min(relative_to_workforce, job.amount);
-
-				static const StringName workers_localisation_key = "PRODUCTION_FACTOR_WORKER";
-
-				switch (job.effect_type) {
-					case OUTPUT:
-						output_from_workers += effect_value;
-						output_string += Utilities::format(
-							employee_effect_template_string,
-							tr(workers_localisation_key),
-							tr(convert_to<String>(pop_type.get_identifier())),
-							_make_modifier_effect_value_coloured(
-								*modifier_effect_cache.get_rgo_output_country(), effect_value, true
-							)
-						);
-						break;
-					case THROUGHPUT:
-						throughput_from_workers += effect_value;
-						throughput_string += Utilities::format(
-							employee_effect_template_string,
-							tr(workers_localisation_key),
-							tr(convert_to<String>(pop_type.get_identifier())),
-							_make_modifier_effect_value_coloured(
-								*modifier_effect_cache.get_rgo_throughput_country(), effect_value, true
-							)
-						);
-						break;
-					default:
-						break;
-				}
-			}
-		}
-
-		{
-			String output_modifiers, throughput_modifiers;
-
-			static const String modifier_effect_contributions_prefix = "\n  -";
-
-			output_modifiers += _make_modifier_effect_contributions_tooltip(
-				*province, *modifier_effect_cache.get_rgo_output_country(), &output_multiplier,
-				modifier_effect_contributions_prefix
-			);
-			output_modifiers += _make_modifier_effect_contributions_tooltip(
-				*province, *modifier_effect_cache.get_local_rgo_output(), &output_multiplier,
-				modifier_effect_contributions_prefix
-			);
-			throughput_modifiers += _make_modifier_effect_contributions_tooltip(
-				*province, *modifier_effect_cache.get_rgo_throughput_country(), &throughput_multiplier,
-				modifier_effect_contributions_prefix
-			);
-			throughput_modifiers += _make_modifier_effect_contributions_tooltip(
-				*province, *modifier_effect_cache.get_local_rgo_throughput(), &throughput_multiplier,
-				modifier_effect_contributions_prefix
-			);
-
-			fixed_point_t size_from_terrain, size_from_province;
-
-			if (production_type.get_is_farm_for_non_tech()) {
-				output_modifiers += _make_modifier_effect_contributions_tooltip(
-					*province, *modifier_effect_cache.get_farm_rgo_output_global(), &output_multiplier,
-					modifier_effect_contributions_prefix
-				);
-				output_modifiers += _make_modifier_effect_contributions_tooltip(
-					*province, *modifier_effect_cache.get_farm_rgo_output_local(), &output_multiplier,
-					modifier_effect_contributions_prefix
-				);
-
-				if (terrain_type != nullptr) {
-					size_from_terrain = terrain_type->get_effect(*modifier_effect_cache.get_farm_rgo_size_local());
-				}
-				size_from_province = province->get_modifier_effect_value(*modifier_effect_cache.get_farm_rgo_size_local());
-			}
-
-			if (production_type.get_is_mine_for_non_tech()) {
-				output_modifiers += _make_modifier_effect_contributions_tooltip(
-					*province, *modifier_effect_cache.get_mine_rgo_output_global(), &output_multiplier,
-					modifier_effect_contributions_prefix
-				);
-				output_modifiers += _make_modifier_effect_contributions_tooltip(
-					*province, *modifier_effect_cache.get_mine_rgo_output_local(), &output_multiplier,
-					modifier_effect_contributions_prefix
-				);
-
-				if (terrain_type != nullptr) {
-					size_from_terrain += terrain_type->get_effect(*modifier_effect_cache.get_mine_rgo_size_local());
-				}
-				size_from_province += province->get_modifier_effect_value(*modifier_effect_cache.get_mine_rgo_size_local());
-			}
-
-			static const String size_modifier_template_string = "%s: %s\n";
-
-			if (size_from_terrain != fixed_point_t::_0) {
-				size_string = Utilities::format(
-					size_modifier_template_string,
-					tr(convert_to<String>(province->get_terrain_type()->get_identifier())),
-					_make_modifier_effect_value_coloured(
-						*modifier_effect_cache.get_farm_rgo_size_local(), size_from_terrain, false
-					)
-				);
-			}
-
-			if (size_from_province != fixed_point_t::_0) {
-				static const StringName rgo_size_localisation_key = "RGO_SIZE";
-
-				size_string += Utilities::format(
-					size_modifier_template_string,
-					tr(rgo_size_localisation_key),
-					_make_modifier_effect_value_coloured(
-						*modifier_effect_cache.get_farm_rgo_size_local(), size_from_province, false
-					)
-				);
-			}
-
-			ModifierEffectCache::good_effects_t const& good_effects =
-				modifier_effect_cache.get_good_effects(production_type.output_good);
-
-			fixed_point_t output_from_tech =
-				province->get_modifier_effect_value(*modifier_effect_cache.get_rgo_output_tech()) +
-				province->get_modifier_effect_value(*good_effects.get_rgo_goods_output());
-			fixed_point_t throughput_from_tech =
-				province->get_modifier_effect_value(*modifier_effect_cache.get_rgo_throughput_tech()) +
-				province->get_modifier_effect_value(*good_effects.get_rgo_goods_throughput());
-
-			fixed_point_t size_from_tech;
-
-			size_from_tech = province->get_modifier_effect_value(*good_effects.get_rgo_size());
-			if (production_type.get_is_farm_for_tech()) {
-				const fixed_point_t value =
-					province->get_modifier_effect_value(*modifier_effect_cache.get_farm_rgo_throughput_and_output());
-				output_from_tech += value;
-				throughput_from_tech += value;
-
-				size_from_tech += province->get_modifier_effect_value(*modifier_effect_cache.get_farm_rgo_size_global());
-			}
-
-			if (production_type.get_is_mine_for_tech()) {
-				const fixed_point_t value =
-					province->get_modifier_effect_value(*modifier_effect_cache.get_mine_rgo_throughput_and_output());
-				output_from_tech += value;
-				throughput_from_tech += value;
-
-				size_from_tech += province->get_modifier_effect_value(*modifier_effect_cache.get_mine_rgo_size_global());
-			}
-
-			if (size_from_tech != fixed_point_t::_0) {
-				static const StringName from_technology_localisation_key = "employ_from_tech";
-
-				size_string += tr(from_technology_localisation_key) + _make_modifier_effect_value_coloured(
-					*modifier_effect_cache.get_farm_rgo_size_global(), size_from_tech, false
-				);
-			}
-
-			static const String tech_modifier_template_string = modifier_effect_contributions_prefix + String { "%s: %s" };
-
-			if (output_from_tech != fixed_point_t::_0) {
-				output_multiplier += output_from_tech;
-
-				static const StringName rgo_output_tech_localisation_key = "RGO_OUTPUT_TECH";
-
-				output_string += Utilities::format(
-					tech_modifier_template_string,
-					tr(rgo_output_tech_localisation_key),
-					_make_modifier_effect_value_coloured(
-						*modifier_effect_cache.get_rgo_output_tech(), output_from_tech, true
-					)
-				);
-			}
-
-			if (throughput_from_tech != fixed_point_t::_0) {
-				throughput_multiplier += throughput_from_tech;
-
-				static const StringName rgo_throughput_tech_localisation_key = "RGO_THROUGHPUT_TECH";
-
-				throughput_string += Utilities::format(
-					tech_modifier_template_string,
-					tr(rgo_throughput_tech_localisation_key),
-					_make_modifier_effect_value_coloured(
-						*modifier_effect_cache.get_rgo_throughput_tech(), throughput_from_tech, true
-					)
-				);
-			}
-
-			output_string += output_modifiers;
-			throughput_string += throughput_modifiers;
-		}
-
-		static const StringName rgo_production_localisation_key = "PROVINCEVIEW_GOODSINCOME";
-		static const String rgo_good_replace_key = "$GOODS$";
-		static const StringName max_output_localisation_key = "PRODUCTION_OUTPUT_GOODS_TOOLTIP2";
-		static const String curr_replace_key = "$CURR$";
-		static const StringName output_explanation_localisation_key = "PRODUCTION_OUTPUT_EXPLANATION";
-		static const StringName base_output_localisation_key = "PRODUCTION_BASE_OUTPUT_GOODS_TOOLTIP";
-		static const String base_replace_key = "$BASE$";
-		static const StringName output_efficiency_localisation_key = "PRODUCTION_OUTPUT_EFFICIENCY_TOOLTIP";
-		static const StringName base_localisation_key = "PRODUCTION_BASE_OUTPUT";
-		static const StringName throughput_efficiency_localisation_key = "PRODUCTION_THROUGHPUT_EFFICIENCY_TOOLTIP";
-		static const String rgo_production_template_string = "%s\n%s%s" + get_tooltip_separator() + "%s%s%s\n%s " +
-			GUILabel::get_colour_marker() + "G100%%" + GUILabel::get_colour_marker() + "!%s\n\n%s%s%s";
-
-		const fixed_point_t throughput_efficiency = throughput_from_workers * throughput_multiplier;
-		const fixed_point_t output_efficiency = output_from_workers * output_multiplier;
-		const fixed_point_t base_output = production_type.base_output_quantity;
-		const fixed_point_t max_output = base_output * throughput_efficiency * output_efficiency;
-
-		ret[province_info_rgo_production_tooltip_key] = Utilities::format(
-			rgo_production_template_string,
-			tr(rgo_production_localisation_key).replace(
-				rgo_good_replace_key, tr(convert_to<String>(rgo_good.get_identifier()))
-			).replace(
-				Utilities::get_long_value_placeholder(),
-				Utilities::fixed_point_to_string_dp(rgo.get_revenue_yesterday(), 3)
-			),
-			tr(max_output_localisation_key).replace(curr_replace_key, Utilities::fixed_point_to_string_dp(max_output, 2)),
-			tr(output_explanation_localisation_key),
-			tr(base_output_localisation_key).replace(base_replace_key, Utilities::fixed_point_to_string_dp(base_output, 2)),
-			tr(output_efficiency_localisation_key),
-			_make_modifier_effect_value_coloured(*modifier_effect_cache.get_rgo_output_country(), output_efficiency, false),
-			tr(base_localisation_key),
-			output_string,
-			tr(throughput_efficiency_localisation_key),
-			_make_modifier_effect_value_coloured(
-				*modifier_effect_cache.get_rgo_throughput_country(), throughput_efficiency, false
-			),
-			throughput_string
-		);
-
-		static const StringName employment_localisation_key = "PROVINCEVIEW_EMPLOYMENT";
-		static const StringName employee_count_localisation_key = "PRODUCTION_FACTORY_EMPLOYEECOUNT_TOOLTIP2";
-		static const String employee_replace_key = "$EMPLOYEES$";
-		static const String employee_max_replace_key = "$EMPLOYEE_MAX$";
-		static const StringName rgo_workforce_localisation_key = "BASE_RGO_SIZE";
-		static const StringName province_size_localisation_key = "FROM_PROV_SIZE";
-		static const String rgo_employment_template_string = "%s" + get_tooltip_separator() + "%s%s\n%s%d\n%s\n%s" +
-			GUILabel::get_colour_marker() + "G%d";
-
-		ret[province_info_rgo_employment_tooltip_key] = Utilities::format(
-			rgo_employment_template_string,
-			tr(employment_localisation_key).replace(Utilities::get_long_value_placeholder(), {}),
-			tr(employee_count_localisation_key).replace(
-				employee_replace_key, String::num_int64(type_safe::get(rgo.get_total_employees_count_cache()))
-			).replace(
-				employee_max_replace_key, String::num_int64(type_safe::get(rgo.get_max_employee_count_cache()))
-			),
-			amount_of_employees_by_pop_type,
-			tr(rgo_workforce_localisation_key),
-			type_safe::get(production_type.base_workforce_size),
-			size_string,
-			tr(province_size_localisation_key),
-			static_cast<int32_t>(rgo.get_size_multiplier()) // TODO - remove cast once variable is an int32_t
-		);
+		ret[province_info_rgo_production_tooltip_id_key] = make_tooltip_id(TOOLTIP_RGO_PRODUCTION, province_number);
+		ret[province_info_rgo_employment_tooltip_id_key] = make_tooltip_id(TOOLTIP_RGO_EMPLOYMENT, province_number);
 	}
 
 	Crime const* crime = province->get_crime();
@@ -1017,9 +1390,7 @@ Dictionary MenuSingleton::get_topbar_info() const {
 	}
 
 	CountryInstance& country = *country_ptr;
-
-	DefinitionManager const& definition_manager = GameSingleton::get_singleton()->get_definition_manager();
-	ModifierEffectCache const& modifier_effect_cache = definition_manager.get_modifier_manager().get_modifier_effect_cache();
+	const int32_t country_tooltip_target = type_safe::get(country.country_definition.index);
 
 	Dictionary ret;
 
@@ -1044,7 +1415,7 @@ Dictionary MenuSingleton::get_topbar_info() const {
 		static const StringName literacy_key = "literacy";
 		static const StringName literacy_change_key = "literacy_change";
 		static const StringName research_points_key = "research_points";
-		static const StringName research_points_tooltip_key = "research_points_tooltip";
+		static const StringName research_points_tooltip_id_key = "research_points_tooltip_id";
 
 		Technology const* current_research = country.get_current_research_untracked();
 		if (current_research != nullptr) {
@@ -1090,81 +1461,7 @@ Dictionary MenuSingleton::get_topbar_info() const {
 
 		ret[research_points_key] = static_cast<real_t>(country.get_daily_research_points_untracked());
 
-		String research_points_tooltip;
-
-		fixed_point_t daily_base_research_points;
-
-		for (auto const& [pop_type, research_points] : country.get_research_points_from_pop_types()) {
-			static const StringName pop_type_research_localisation_key = "TECH_DAILY_RESEARCHPOINTS_TOOLTIP";
-			static const String pop_type_replace_key = "$POPTYPE$";
-			static const String fraction_replace_key = "$FRACTION$";
-			static const String optimal_replace_key = "$OPTIMAL$";
-
-			daily_base_research_points += research_points;
-
-			research_points_tooltip += tr(pop_type_research_localisation_key).replace(
-				pop_type_replace_key, tr(convert_to<String>(pop_type->get_identifier()))
-			).replace(
-				Utilities::get_long_value_placeholder(),
-				Utilities::fixed_point_to_string_dp(research_points, 2)
-			).replace(
-				fraction_replace_key, Utilities::fixed_point_to_string_dp(
-					fp::from_fraction(
-						100 * country.get_population_by_type()[pop_type->index],
-						country.get_total_population()
-					), 2
-				)
-			).replace(
-				optimal_replace_key, Utilities::fixed_point_to_string_dp(100 * pop_type->research_leadership_optimum, 2)
-			) + "\n";
-		}
-
-		// Empty prefix, "\n" suffix, fitting with the potential trailing "\n" from the pop type contributions and the upcoming
-		// guaranteed daily base research points line. All contributions are added to daily_base_research_points.
-		research_points_tooltip += _make_modifier_effect_contributions_tooltip(
-			country, *modifier_effect_cache.get_research_points(), &daily_base_research_points, {}, "\n"
-		);
-
-		// The daily base research points line is guaranteed to be present, but those directly above and below it aren't,
-		// so this line has no newline characters of its own. Instead, potential lines above finish with newlines and
-		// potential (and some guaranteed) lines below start with them.
-		static const StringName daily_base_research_points_localisation_key = "TECH_DAILY_RESEARCHPOINTS_BASE_TOOLTIP";
-		research_points_tooltip += tr(daily_base_research_points_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			Utilities::fixed_point_to_string_dp(daily_base_research_points, 2)
-		);
-
-		research_points_tooltip += _make_modifier_effect_contributions_tooltip(
-			country, *modifier_effect_cache.get_research_points_modifier()
-		);
-
-		const fixed_point_t research_points_modifier_from_tech = country.get_modifier_effect_value(
-			*modifier_effect_cache.get_increase_research()
-		);
-		if (research_points_modifier_from_tech != fixed_point_t::_0) {
-			static const StringName from_technology_localisation_key = "FROM_TECHNOLOGY";
-			research_points_tooltip += "\n" + tr(from_technology_localisation_key) + ": " +
-				_make_modifier_effect_value_coloured(
-					*modifier_effect_cache.get_increase_research(), research_points_modifier_from_tech, true
-				);
-		}
-
-		static const StringName daily_research_points_localisation_key = "TECH_DAILY_RESEARCHPOINTS_TOTAL_TOOLTIP";
-		research_points_tooltip += "\n" + tr(daily_research_points_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			Utilities::fixed_point_to_string_dp(country.get_daily_research_points_untracked(), 2)
-		);
-
-		// In the base game this section is only shown when no research is set, but it's useful to show it always
-		research_points_tooltip += "\n" + get_tooltip_separator();
-
-		static const StringName accumulated_research_points_localisation_key = "RP_ACCUMULATED";
-		research_points_tooltip += tr(accumulated_research_points_localisation_key).replace(
-			Utilities::get_short_value_placeholder(),
-			Utilities::fixed_point_to_string_dp(country.get_research_point_stockpile_untracked(), 1)
-		);
-
-		ret[research_points_tooltip_key] = std::move(research_points_tooltip);
+		ret[research_points_tooltip_id_key] = make_tooltip_id(TOOLTIP_RESEARCH_POINTS, country_tooltip_target);
 	}
 
 	// Politics
@@ -1184,88 +1481,22 @@ Dictionary MenuSingleton::get_topbar_info() const {
 
 	static const StringName is_mobilised_key = "is_mobilised";
 	static const StringName mobilisation_regiments_key = "mobilisation_regiments";
-	static const StringName mobilisation_impact_tooltip_key = "mobilisation_impact_tooltip";
+	static const StringName mobilisation_impact_tooltip_id_key = "mobilisation_impact_tooltip_id";
 
 	if (country.is_mobilised()) {
 		ret[is_mobilised_key] = true;
 	} else {
 		ret[mobilisation_regiments_key] = static_cast<uint64_t>(country.get_mobilisation_potential_regiment_count());
-		ret[mobilisation_impact_tooltip_key] = _make_mobilisation_impact_tooltip();
+		ret[mobilisation_impact_tooltip_id_key] = make_tooltip_id(TOOLTIP_MOBILISATION_IMPACT, country_tooltip_target);
 	}
 
 	{
 		static const StringName leadership_key = "leadership";
-		static const StringName leadership_tooltip_key = "leadership_tooltip";
+		static const StringName leadership_tooltip_id_key = "leadership_tooltip_id";
 
 		ret[leadership_key] = country.get_leadership_point_stockpile().truncate<int64_t>();
 
-		String leadership_tooltip;
-
-		fixed_point_t monthly_base_leadership_points;
-
-		for (auto const& [pop_type, leadership_points] : country.get_leadership_points_from_pop_types()) {
-			static const StringName pop_type_leadership_localisation_key = "TECH_DAILY_LEADERSHIP_TOOLTIP";
-			static const String pop_type_replace_key = "$POPTYPE$";
-			static const String fraction_replace_key = "$FRACTION$";
-			static const String optimal_replace_key = "$OPTIMAL$";
-
-			monthly_base_leadership_points += leadership_points;
-
-			leadership_tooltip += tr(pop_type_leadership_localisation_key).replace(
-				pop_type_replace_key, tr(convert_to<String>(pop_type->get_identifier()))
-			).replace(
-				Utilities::get_long_value_placeholder(),
-				Utilities::fixed_point_to_string_dp(leadership_points, 2)
-			).replace(
-				fraction_replace_key, Utilities::fixed_point_to_string_dp(
-					fp::from_fraction(
-						100 * country.get_population_by_type()[pop_type->index],
-						country.get_total_population()
-					), 2
-				)
-			).replace(
-				optimal_replace_key, Utilities::fixed_point_to_string_dp(100 * pop_type->research_leadership_optimum, 2)
-			) + "\n";
-		}
-
-		// Empty prefix, "\n" suffix, fitting with the potential trailing "\n" from the pop type contributions and the upcoming
-		// guaranteed monthly base leadership points line. All contributions are added to monthly_base_leadership_points.
-		leadership_tooltip += _make_modifier_effect_contributions_tooltip(
-			country, *modifier_effect_cache.get_leadership(), &monthly_base_leadership_points, {}, "\n"
-		);
-
-		// The monthly base leadership points line is guaranteed to be present, but those directly above and below it aren't,
-		// so this line has no newline characters of its own. Instead, potential lines above finish with newlines and
-		// potential (and some guaranteed) lines below start with them.
-		static const StringName monthly_base_leadership_localisation_key = "TECH_DAILY_LEADERSHIP_BASE_TOOLTIP";
-		leadership_tooltip += tr(monthly_base_leadership_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			Utilities::fixed_point_to_string_dp(monthly_base_leadership_points, 2)
-		);
-
-		leadership_tooltip += _make_modifier_effect_contributions_tooltip(
-			country, *modifier_effect_cache.get_leadership_modifier()
-		);
-
-		static const StringName monthly_leadership_points_localisation_key = "TECH_DAILY_LEADERSHIP_TOTAL_TOOLTIP";
-		leadership_tooltip += "\n" + tr(monthly_leadership_points_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			Utilities::fixed_point_to_string_dp(country.get_monthly_leadership_points(), 2)
-		);
-
-		const fixed_point_t max_leadership_point_stockpile =
-			definition_manager.get_define_manager().get_military_defines().get_max_leadership_point_stockpile();
-		if (country.get_leadership_point_stockpile() >= max_leadership_point_stockpile) {
-			leadership_tooltip += "\n" + get_tooltip_separator() + "\n";
-
-			static const StringName max_leadership_points_localisation_key = "TOPBAR_LEADERSHIP_MAX";
-			static const String max_replace_key = "$MAX$";
-			leadership_tooltip += tr(max_leadership_points_localisation_key).trim_suffix("\n").replace(
-				max_replace_key, Utilities::fixed_point_to_string_dp(max_leadership_point_stockpile, 1)
-			);
-		}
-
-		ret[leadership_tooltip_key] = std::move(leadership_tooltip);
+		ret[leadership_tooltip_id_key] = make_tooltip_id(TOOLTIP_LEADERSHIP, country_tooltip_target);
 	}
 
 	return ret;
@@ -2,10 +2,12 @@
 
 #include <cstdint>
 #include <functional>
+#include <utility>
 #include <variant>
 
 #include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 
 #include <openvic-simulation/military/UnitInstanceGroup.hpp>
 #include <openvic-simulation/population/PopSize.hpp>
@@ -20,6 +22,7 @@
 
 namespace OpenVic {
 	struct CountryInstance;
+	struct GoodInstance;
 	struct State;
 	struct ProvinceInstance;
 	struct Pop;
@@ -73,12 +76,46 @@ namespace OpenVic {
 			std::vector<province_list_entry_t> province_list_entries;
 			int32_t visible_province_list_entries = 0;
 
+			/* The province list is split into blocks, each a country or state entry followed by the province entries
+			 * under it (if any), whose rows are only visible while the block is expanded. */
+			struct province_list_blocks_t {
+				/* The entry index of each block's first entry, followed by the total number of entries. */
+				std::vector<int32_t> starts;
+				/* The index of the block containing each entry. */
+				std::vector<int32_t> entry_blocks;
+				/* The number of visible rows in each block. */
+				std::vector<int32_t> visible_rows;
+				/* Fenwick tree over visible_rows, so the block containing a given visible row can be found, and a block's
+				 * visible row count changed, in logarithmic time. */
+				std::vector<int32_t> visible_rows_tree;
+
+				void clear();
+				/* Start a new block at the next entry, with a single visible row. */
+				void add_block();
+				void add_entry_to_last_block();
+				/* Build visible_rows_tree once all blocks have been added. */
+				void build_tree();
+
+				void set_visible_rows(int32_t block, int32_t rows);
+				int32_t get_visible_rows_before(int32_t block) const;
+				/* The block containing the given visible row, and the number of visible rows before that block. */
+				std::pair<int32_t, int32_t> find_visible_row(int32_t row) const;
+			};
+			province_list_blocks_t province_list_blocks;
+
 			struct pop_filter_t {
 				pop_size_t count, promotion_demotion_change;
 				bool selected = false;
 			};
 			ordered_map<PopType const*, pop_filter_t> pop_filters;
 
+			/* The keys with non-zero values in a distribution, in index order, and their normalised values. */
+			template<typename KeyType>
+			struct distribution_t {
+				std::vector<KeyType const*> keys;
+				std::vector<fixed_point_t> values;
+			};
+
 			static constexpr int32_t DISTRIBUTION_COUNT = 6;
 			/* Distributions:
 			 *  - Workforce (PopType)
@@ -87,13 +124,27 @@ namespace OpenVic {
 			 *  - Nationality (Culture)
 			 *  - Issues
 			 *  - Vote */
-			fixed_point_map_t<PopType const*> workforce_distribution;
-			fixed_point_map_t<Religion const*> religion_distribution;
-			fixed_point_map_t<Ideology const*> ideology_distribution;
-			fixed_point_map_t<Culture const*> culture_distribution;
+			distribution_t<PopType> workforce_distribution;
+			distribution_t<Religion> religion_distribution;
+			distribution_t<Ideology> ideology_distribution;
+			distribution_t<Culture> culture_distribution;
 			fixed_point_map_t<BaseIssue const*> issue_distribution;
 			fixed_point_map_t<CountryParty const*> vote_distribution;
 
+			/* Partial distribution totals for one chunk of filtered pops. Chunks are summed in parallel on the
+			 * WorkerThreadPool and then merged. Totals are indexed by pop_type_index_t and ideology_index_t, and by
+			 * position in the definition manager's lists for religions and cultures, to avoid map lookups in the per-pop
+			 * loop. Votes are keyed by each country's own parties, so stay in a map. Kept between updates to reuse their
+			 * buffers. */
+			struct pop_aggregate_t {
+				std::vector<fixed_point_t> workforce;
+				std::vector<fixed_point_t> religion;
+				std::vector<fixed_point_t> ideology;
+				std::vector<fixed_point_t> culture;
+				fixed_point_map_t<CountryParty const*> vote;
+			};
+			std::vector<pop_aggregate_t> pop_aggregates;
+
 			PopSortKey sort_key = SORT_NONE;
 			bool sort_descending = true;
 			IndexedFlatMap<PopType, size_t> pop_type_sort_cache;
@@ -101,11 +152,55 @@ namespace OpenVic {
 			ordered_map<Religion const*, size_t> religion_sort_cache;
 			IndexedFlatMap<ProvinceInstance, size_t> province_sort_cache;
 			IndexedFlatMap<RebelType, size_t> rebel_type_sort_cache;
+			/* The locale the sort caches were last filled for, or empty if they need filling. */
+			godot::StringName sort_cache_locale;
+
+			/* The rank of each pop type, culture, religion, province and rebel type when sorted by localised name,
+			 * indexed by position in their lists. Computed once per locale and kept for the rest of the run, so switching
+			 * back to a locale or starting another session only needs the sort caches refilling from these. */
+			struct locale_sort_ranks_t {
+				std::vector<size_t> pop_types, cultures, religions, provinces, rebel_types;
+			};
+			godot::HashMap<godot::StringName, locale_sort_ranks_t> locale_sort_ranks;
 
 			std::vector<std::reference_wrapper<const Pop>> pops, filtered_pops;
+			/* The number of filtered pops at the front of the list in their final sorted order. The rest are sorted as
+			 * their rows are requested. */
+			size_t sorted_pop_count = 0;
+			/* The pops after those in their final order, decorated with their sort keys, kept between lazy sorts so each
+			 * pop's key is only computed once per sort. Their key type depends on the sort key, so they're stored behind
+			 * this base. Reset whenever the sort key, direction or filters change, and on every refresh as keys change. */
+			struct pop_sort_entries_base_t {
+				PopSortKey sort_key = SORT_NONE;
+				bool ascending = false;
+				/* The position in filtered_pops of the first entry. */
+				size_t begin = 0;
+
+				virtual ~pop_sort_entries_base_t() = default;
+			};
+			memory::unique_ptr<pop_sort_entries_base_t> pop_sort_entries;
+
+			/* How long each step of the last refresh took, in microseconds. */
+			struct refresh_timings_t {
+				uint64_t pops_usec = 0, distributions_usec = 0, sort_usec = 0;
+				/* Whether the pops were collected and filtered again, rather than kept in their previous order. */
+				bool pops_collected = false;
+			};
+			refresh_timings_t refresh_timings;
+
 			population_menu_t();
 		};
 
+		/* Expensive tooltips are identified by a tooltip ID made from one of these kinds and a target (the index of the
+		 * country or good, or the number of the province, the tooltip is about), and only generated when shown. */
+		enum TooltipKind {
+			TOOLTIP_NONE, TOOLTIP_MOBILISATION_IMPACT, TOOLTIP_RESEARCH_POINTS, TOOLTIP_LEADERSHIP, TOOLTIP_RGO_PRODUCTION,
+			TOOLTIP_RGO_EMPLOYMENT, TOOLTIP_GOOD_TOP_PRODUCERS, TOOLTIP_WAR_EXHAUSTION, TOOLTIP_SUPPLY_CONSUMPTION,
+			TOOLTIP_ORGANISATION_REGAIN, TOOLTIP_LAND_ORGANISATION, TOOLTIP_NAVAL_ORGANISATION, TOOLTIP_UNIT_START_EXPERIENCE,
+			TOOLTIP_RECRUIT_TIME, TOOLTIP_COMBAT_WIDTH, TOOLTIP_MOBILISATION_SIZE, TOOLTIP_MOBILISE,
+			TOOLTIP_MOBILISATION_ECONOMY_IMPACT, MAX_TOOLTIP_KIND
+		};
+
 		enum TradeSettingBit {
 			TRADE_SETTING_NONE = 0, TRADE_SETTING_AUTOMATED = 1, TRADE_SETTING_BUYING = 2, TRADE_SETTING_SELLING = 4
 		};
@@ -127,6 +222,45 @@ namespace OpenVic {
 		population_menu_t population_menu;
 		search_panel_t search_panel;
 
+		/* Text generated for tooltip IDs, kept until the gamestate or locale next changes. */
+		ordered_map<int64_t, godot::String> tooltip_cache;
+
+		/* The currently shown tooltip if it was shown from a tooltip ID, so its text can be regenerated while shown. */
+		struct provided_tooltip_t {
+			int64_t tooltip_id = 0;
+			godot::String text;
+			godot::Dictionary substitution_dict;
+			/* Instance ID rather than pointer, as the control may be freed while its tooltip is shown. */
+			uint64_t control_id = 0;
+		};
+		provided_tooltip_t provided_tooltip;
+
+		/* A country's or province's modifier sum paired with one of the effects it sums. */
+		struct modifier_contributions_key_t {
+			void const* modifier_sum;
+			ModifierEffect const* effect;
+
+			static uint32_t hash(modifier_contributions_key_t const& key);
+			constexpr bool operator==(modifier_contributions_key_t const&) const = default;
+		};
+		/* The total contributed to an effect and one formatted line per contributing modifier, without prefix or suffix. */
+		struct modifier_contributions_t {
+			fixed_point_t total;
+			std::vector<godot::String> lines;
+		};
+		/* Contributions kept until the gamestate next changes, as the same effects' contributions are listed in many
+		 * tooltips and menus are refreshed far more often than the gamestate is updated. */
+		mutable godot::HashMap<
+			modifier_contributions_key_t, modifier_contributions_t, modifier_contributions_key_t
+		> modifier_contributions_cache;
+
+		/* Clear caches of gamestate-derived text, before any gamestate_updated handler can read them. */
+		void _on_gamestate_invalidated();
+		/* Rebuild menus made from the player's country, before the gamestate update following the change. */
+		void _on_player_country_changed();
+		/* Show the provided tooltip again with newly generated text, if it's still shown. */
+		void _refresh_provided_tooltip();
+
 		/* Emitted when the number of visible province list rows changes (list generated or state entry expanded).*/
 		static godot::StringName const& _signal_population_menu_province_list_changed();
 		/* Emitted when the state of visible province list rows changes (selection changes). Provides an integer argument
@@ -160,7 +294,17 @@ namespace OpenVic {
 
 		godot::String _make_rules_tooltip(RuleSet const& rules) const;
 
-		godot::String _make_mobilisation_impact_tooltip() const;
+		godot::String _make_mobilisation_impact_tooltip(CountryInstance const& country) const;
+		godot::String _make_research_points_tooltip(CountryInstance const& country) const;
+		godot::String _make_leadership_tooltip(CountryInstance const& country) const;
+		godot::String _make_mobilisation_size_tooltip(CountryInstance const& country) const;
+		/* Generate the tooltip for one of the military menu's country stats, from TOOLTIP_WAR_EXHAUSTION up to
+		 * TOOLTIP_MOBILISATION_ECONOMY_IMPACT. */
+		godot::String _make_military_stat_tooltip(TooltipKind kind, CountryInstance const& country) const;
+		void _make_rgo_tooltips(
+			ProvinceInstance const& province, godot::String& production_tooltip, godot::String& employment_tooltip
+		) const;
+		godot::String _make_good_top_producers_tooltip(GoodInstance const& good) const;
 
 	protected:
 		static void _bind_methods();
@@ -187,6 +331,21 @@ namespace OpenVic {
 		);
 		void hide_tooltip();
 
+		static int64_t make_tooltip_id(TooltipKind kind, int32_t target);
+		/* Placeholder for the provided text when showing a tooltip ID together with a tooltip string. */
+		static godot::String get_provided_tooltip_placeholder();
+		/* Generate the text for a tooltip ID, or return the text generated earlier if the gamestate hasn't changed since. */
+		godot::String get_tooltip_text(int64_t tooltip_id);
+		/* Show the text for tooltip_id on its own if text is empty, otherwise show text with the text for tooltip_id
+		 * substituted in place of the provided tooltip placeholder. */
+		void show_control_provided_tooltip(
+			int64_t tooltip_id, godot::String const& text, godot::Dictionary const& substitution_dict,
+			godot::Control const* control
+		);
+		/* Drop all text generated for tooltip IDs, e.g. when the locale it was translated into changes, and regenerate
+		 * the shown tooltip if it's from a tooltip ID. */
+		void clear_tooltip_cache();
+
 		/* PROVINCE OVERVIEW PANEL */
 		/* Get info to display in Province Overview Panel, packaged in a Dictionary using StringName constants as keys. */
 		godot::Dictionary get_province_info_from_number(int32_t province_number) const;
@@ -216,11 +375,20 @@ namespace OpenVic {
 		godot::Error population_menu_select_province(int32_t province_number);
 		godot::Error population_menu_toggle_expanded(int32_t toggle_index, bool emit_selected_changed = true);
 
+		bool _population_menu_pops_changed() const;
+		bool _population_menu_filtered_pops_changed() const;
+		void _population_menu_collect_pops();
+		void _population_menu_update_pop_filter_counts();
+		void _population_menu_filter_pops();
 		godot::Error _population_menu_update_pops();
 		godot::Error _population_menu_update_filtered_pops();
-		using sort_func_t = std::function<bool(Pop const&, Pop const&)>;
-		sort_func_t _get_population_menu_sort_func(PopSortKey sort_key) const;
+		void _population_menu_aggregate_pops(uint32_t chunk_index);
+		godot::Error _population_menu_update_distributions();
+		godot::Error _population_menu_order_pops();
+		godot::Error _population_menu_sort_pops_up_to(size_t sorted_end);
 		godot::Error _population_menu_sort_pops();
+		godot::Error population_menu_refresh();
+		godot::Dictionary get_population_menu_refresh_timings() const;
 		godot::Error population_menu_update_locale_sort_cache();
 		godot::Error population_menu_select_sort_key(PopSortKey sort_key);
 		template<IsPieChartKey KeyType, IsPieChartValue ValueType>
@@ -231,7 +399,11 @@ namespace OpenVic {
 		GFXPieChartTexture::godot_pie_chart_data_t generate_population_menu_pop_row_pie_chart_data(
 			Container const& distribution, godot::String const& identifier_suffix = {}
 		) const;
-		godot::TypedArray<godot::Dictionary> get_population_menu_pop_rows(int32_t start, int32_t count) const;
+		godot::Error _population_menu_prepare_pop_rows(int32_t start, int32_t& count);
+		godot::TypedArray<godot::Dictionary> get_population_menu_pop_rows(int32_t start, int32_t count);
+		/* The same values as get_population_menu_pop_rows, as a Dictionary of packed arrays with an entry per row rather
+		 * than an Array of Dictionaries. Pie chart slice weights aren't normalised, as set_slices_packed does that. */
+		godot::Dictionary get_population_menu_pop_columns(int32_t start, int32_t count);
 		int32_t get_population_menu_pop_row_count() const;
 
 		godot::Error _population_menu_generate_pop_filters();
@@ -307,4 +479,5 @@ namespace OpenVic {
 
 VARIANT_ENUM_CAST(OpenVic::MenuSingleton::ProvinceListEntry);
 VARIANT_ENUM_CAST(OpenVic::MenuSingleton::PopSortKey);
+VARIANT_ENUM_CAST(OpenVic::MenuSingleton::TooltipKind);
 VARIANT_ENUM_CAST(OpenVic::MenuSingleton::TradeSettingBit);
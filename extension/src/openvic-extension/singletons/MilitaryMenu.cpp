@@ -345,219 +345,163 @@ Dictionary MenuSingleton::make_in_progress_unit_dict() const {
 	return in_progress_unit_dict;
 }
 
-Dictionary MenuSingleton::get_military_menu_info() {
-	cached_leader_dicts.clear();
+String MenuSingleton::_make_mobilisation_size_tooltip(CountryInstance const& country) const {
+	ModifierEffectCache const& modifier_effect_cache =
+		GameSingleton::get_singleton()->get_definition_manager().get_modifier_manager().get_modifier_effect_cache();
 
-	GameSingleton const* game_singleton = GameSingleton::get_singleton();
-	ERR_FAIL_NULL_V(game_singleton, {});
+	static const StringName mobilisation_size_tooltip_localisation_key = "MOB_SIZE_IRO";
+	static const StringName mobilisation_size_tech_tooltip_localisation_key = "MOB_FROM_TECH";
 
-	DefinitionManager const& definition_manager = game_singleton->get_definition_manager();
-	ModifierEffectCache const& modifier_effect_cache = definition_manager.get_modifier_manager().get_modifier_effect_cache();
-	StaticModifierCache const& static_modifier_cache = definition_manager.get_modifier_manager().get_static_modifier_cache();
-	IssueManager const& issue_manager = definition_manager.get_politics_manager().get_issue_manager();
-
-	CountryInstance const* country = PlayerSingleton::get_singleton()->get_player_country();
-	if (country == nullptr) {
-		return {};
-	}
+	const fixed_point_t mobilisation_size_from_tech = country.get_modifier_effect_value(
+		*modifier_effect_cache.get_mobilisation_size_tech()
+	);
 
-	Dictionary ret;
+	String mobilisation_size_tooltip = tr(mobilisation_size_tooltip_localisation_key).replace(
+		Utilities::get_long_value_placeholder(),
+		Utilities::fixed_point_to_string_dp(
+			(
+				country.get_modifier_effect_value(*modifier_effect_cache.get_mobilisation_size_country()) +
+				mobilisation_size_from_tech
+			) * 100, 2
+		)
+	);
 
-	// Military stats
-	static const StringName military_info_war_exhaustion_key = "war_exhaustion";
-	static const StringName military_info_war_exhaustion_tooltip_key = "war_exhaustion_tooltip";
-	static const StringName military_info_supply_consumption_key = "supply_consumption";
-	static const StringName military_info_supply_consumption_tooltip_key = "supply_consumption_tooltip";
-	static const StringName military_info_organisation_regain_key = "organisation_regain";
-	static const StringName military_info_organisation_regain_tooltip_key = "organisation_regain_tooltip";
-	static const StringName military_info_land_organisation_key = "land_organisation";
-	static const StringName military_info_land_organisation_tooltip_key = "land_organisation_tooltip";
-	static const StringName military_info_naval_organisation_key = "naval_organisation";
-	static const StringName military_info_naval_organisation_tooltip_key = "naval_organisation_tooltip";
-	static const StringName military_info_land_unit_start_experience_key = "land_unit_start_experience";
-	static const StringName military_info_naval_unit_start_experience_key = "naval_unit_start_experience";
-	static const StringName military_info_unit_start_experience_tooltip_key = "unit_start_experience_tooltip";
-	static const StringName military_info_recruit_time_key = "recruit_time";
-	static const StringName military_info_recruit_time_tooltip_key = "recruit_time_tooltip";
-	static const StringName military_info_combat_width_key = "combat_width";
-	static const StringName military_info_combat_width_tooltip_key = "combat_width_tooltip";
-	static const StringName military_info_dig_in_cap_key = "dig_in_cap";
-	static const StringName military_info_military_tactics_key = "military_tactics";
+	if (mobilisation_size_from_tech != fixed_point_t::_0) {
+		mobilisation_size_tooltip += "\n" + tr(mobilisation_size_tech_tooltip_localisation_key).replace(
+			Utilities::get_long_value_placeholder(),
+			_make_modifier_effect_value_coloured(
+				*modifier_effect_cache.get_mobilisation_size_country(), mobilisation_size_from_tech, false
+			)
+		);
+	}
 
-	static const String war_exhaustion_template_string = "%s/%s";
-	const String war_exhaustion_string = Utilities::fixed_point_to_string_dp(country->get_war_exhaustion(), 2);
-	const String max_war_exhaustion_string = Utilities::fixed_point_to_string_dp(country->get_war_exhaustion_max(), 2);
-	ret[military_info_war_exhaustion_key] = Utilities::format(
-		war_exhaustion_template_string, war_exhaustion_string, max_war_exhaustion_string
+	mobilisation_size_tooltip += _make_modifier_effect_contributions_tooltip(
+		country, *modifier_effect_cache.get_mobilisation_size_country()
 	);
 
-	static const StringName war_exhaustion_localisation_key = "MILITARY_WAR_EXHAUSTION_TOOLTIP";
-	static const StringName max_war_exhaustion_localisation_key = "MILITARY_MAX_WAR_EXHAUSTION_TOOLTIP";
-	static const String current_effects_localisation_key = "WEX_EFFECTS";
-	static const String war_exhaustion_tooltip_template_string = "%s%s\n\n%s%s" + get_tooltip_separator() + "%s%s";
+	return mobilisation_size_tooltip;
+}
 
-	ret[military_info_war_exhaustion_tooltip_key] = Utilities::format(
-		war_exhaustion_tooltip_template_string,
-		tr(war_exhaustion_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			war_exhaustion_string
-		),
-		_make_modifier_effect_contributions_tooltip(*country, *modifier_effect_cache.get_war_exhaustion_monthly()),
-		tr(max_war_exhaustion_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			max_war_exhaustion_string
-		),
-		_make_modifier_effect_contributions_tooltip(*country, *modifier_effect_cache.get_max_war_exhaustion()),
-		tr(current_effects_localisation_key),
-		_make_modifier_effects_tooltip(static_modifier_cache.get_war_exhaustion() * country->get_war_exhaustion())
-	);
+String MenuSingleton::_make_military_stat_tooltip(TooltipKind kind, CountryInstance const& country) const {
+	DefinitionManager const& definition_manager = GameSingleton::get_singleton()->get_definition_manager();
+	ModifierEffectCache const& modifier_effect_cache = definition_manager.get_modifier_manager().get_modifier_effect_cache();
 
 	static const StringName base_value_percent_localisation_key = "MILITARY_BASEVALUE_PERCENT";
-	const String base_value_percent_tooltip = tr(base_value_percent_localisation_key);
+	static const StringName from_tech_localisation_key = "FROM_TECHNOLOGY";
 
-	ret[military_info_supply_consumption_key] = static_cast<real_t>(country->get_supply_consumption());
-	ret[military_info_supply_consumption_tooltip_key] = base_value_percent_tooltip +
-		_make_modifier_effect_contributions_tooltip(*country, *modifier_effect_cache.get_supply_consumption());
+	switch (kind) {
+	case TOOLTIP_WAR_EXHAUSTION: {
+		StaticModifierCache const& static_modifier_cache =
+			definition_manager.get_modifier_manager().get_static_modifier_cache();
 
-	static const StringName from_tech_localisation_key = "FROM_TECHNOLOGY";
-	const String from_technology_tooltip = "\n" + tr(from_tech_localisation_key) + ": ";
+		static const StringName war_exhaustion_localisation_key = "MILITARY_WAR_EXHAUSTION_TOOLTIP";
+		static const StringName max_war_exhaustion_localisation_key = "MILITARY_MAX_WAR_EXHAUSTION_TOOLTIP";
+		static const String current_effects_localisation_key = "WEX_EFFECTS";
+		static const String war_exhaustion_tooltip_template_string = "%s%s\n\n%s%s" + get_tooltip_separator() + "%s%s";
 
-	ret[military_info_organisation_regain_key] = static_cast<real_t>(country->get_organisation_regain());
-	{
-		String organisation_regain_tooltip = base_value_percent_tooltip;
-		const fixed_point_t morale = country->get_modifier_effect_value(*modifier_effect_cache.get_morale_global());
+		return Utilities::format(
+			war_exhaustion_tooltip_template_string,
+			tr(war_exhaustion_localisation_key).replace(
+				Utilities::get_long_value_placeholder(),
+				Utilities::fixed_point_to_string_dp(country.get_war_exhaustion(), 2)
+			),
+			_make_modifier_effect_contributions_tooltip(country, *modifier_effect_cache.get_war_exhaustion_monthly()),
+			tr(max_war_exhaustion_localisation_key).replace(
+				Utilities::get_long_value_placeholder(),
+				Utilities::fixed_point_to_string_dp(country.get_war_exhaustion_max(), 2)
+			),
+			_make_modifier_effect_contributions_tooltip(country, *modifier_effect_cache.get_max_war_exhaustion()),
+			tr(current_effects_localisation_key),
+			_make_modifier_effects_tooltip(static_modifier_cache.get_war_exhaustion() * country.get_war_exhaustion())
+		);
+	}
+	case TOOLTIP_SUPPLY_CONSUMPTION:
+		return tr(base_value_percent_localisation_key) +
+			_make_modifier_effect_contributions_tooltip(country, *modifier_effect_cache.get_supply_consumption());
+	case TOOLTIP_ORGANISATION_REGAIN: {
+		String organisation_regain_tooltip = tr(base_value_percent_localisation_key);
+		const fixed_point_t morale = country.get_modifier_effect_value(*modifier_effect_cache.get_morale_global());
 		if (morale != fixed_point_t::_0) {
-			organisation_regain_tooltip += from_technology_tooltip + _make_modifier_effect_value_coloured(
-				*modifier_effect_cache.get_morale_global(), morale, true
-			);
+			organisation_regain_tooltip += "\n" + tr(from_tech_localisation_key) + ": " +
+				_make_modifier_effect_value_coloured(*modifier_effect_cache.get_morale_global(), morale, true);
 		}
 		organisation_regain_tooltip += _make_modifier_effect_contributions_tooltip(
-			*country, *modifier_effect_cache.get_org_regain()
+			country, *modifier_effect_cache.get_org_regain()
 		);
-		ret[military_info_organisation_regain_tooltip_key] = std::move(organisation_regain_tooltip);
+		return organisation_regain_tooltip;
 	}
-
-	ret[military_info_land_organisation_key] = static_cast<real_t>(country->get_land_organisation());
-	ret[military_info_land_organisation_tooltip_key] = base_value_percent_tooltip +
-		_make_modifier_effect_contributions_tooltip(*country, *modifier_effect_cache.get_land_organisation());
-
-	ret[military_info_naval_organisation_key] = static_cast<real_t>(country->get_naval_organisation());
-	ret[military_info_naval_organisation_tooltip_key] = base_value_percent_tooltip +
-		_make_modifier_effect_contributions_tooltip(*country, *modifier_effect_cache.get_naval_organisation());
-
-	ret[military_info_land_unit_start_experience_key] = static_cast<real_t>(country->get_land_unit_start_experience());
-	ret[military_info_naval_unit_start_experience_key] = static_cast<real_t>(country->get_naval_unit_start_experience());
-	{
+	case TOOLTIP_LAND_ORGANISATION:
+		return tr(base_value_percent_localisation_key) +
+			_make_modifier_effect_contributions_tooltip(country, *modifier_effect_cache.get_land_organisation());
+	case TOOLTIP_NAVAL_ORGANISATION:
+		return tr(base_value_percent_localisation_key) +
+			_make_modifier_effect_contributions_tooltip(country, *modifier_effect_cache.get_naval_organisation());
+	case TOOLTIP_UNIT_START_EXPERIENCE: {
 		static const StringName base_value_localisation_key = "MILITARY_BASEVALUE";
 		String unit_start_experience_tooltip = tr(base_value_localisation_key);
-		const fixed_point_t regular_experience_level = country->get_modifier_effect_value(
+		const fixed_point_t regular_experience_level = country.get_modifier_effect_value(
 			*modifier_effect_cache.get_regular_experience_level()
 		);
 		if (regular_experience_level != fixed_point_t::_0) {
-			unit_start_experience_tooltip += from_technology_tooltip + _make_modifier_effect_value_coloured(
-				*modifier_effect_cache.get_regular_experience_level(), regular_experience_level, true
-			);
+			unit_start_experience_tooltip += "\n" + tr(from_tech_localisation_key) + ": " +
+				_make_modifier_effect_value_coloured(
+					*modifier_effect_cache.get_regular_experience_level(), regular_experience_level, true
+				);
 		}
 		const String land_unit_start_experience_tooltip = _make_modifier_effect_contributions_tooltip(
-			*country, *modifier_effect_cache.get_land_unit_start_experience()
+			country, *modifier_effect_cache.get_land_unit_start_experience()
 		);
 		const String naval_unit_start_experience_tooltip = _make_modifier_effect_contributions_tooltip(
-			*country, *modifier_effect_cache.get_naval_unit_start_experience()
+			country, *modifier_effect_cache.get_naval_unit_start_experience()
 		);
 		unit_start_experience_tooltip += land_unit_start_experience_tooltip;
 		if (!land_unit_start_experience_tooltip.is_empty() && !naval_unit_start_experience_tooltip.is_empty()) {
 			unit_start_experience_tooltip += "\n";
 		}
 		unit_start_experience_tooltip += naval_unit_start_experience_tooltip;
-		ret[military_info_unit_start_experience_tooltip_key] = std::move(unit_start_experience_tooltip);
+		return unit_start_experience_tooltip;
 	}
-
-	ret[military_info_recruit_time_key] = static_cast<real_t>(country->get_recruit_time());
-	ret[military_info_recruit_time_tooltip_key] = base_value_percent_tooltip + _make_modifier_effect_contributions_tooltip(
-		*country, *modifier_effect_cache.get_unit_recruitment_time()
-	);
-
-	ret[military_info_combat_width_key] = type_safe::get(country->get_combat_width());
-	{
+	case TOOLTIP_RECRUIT_TIME:
+		return tr(base_value_percent_localisation_key) +
+			_make_modifier_effect_contributions_tooltip(country, *modifier_effect_cache.get_unit_recruitment_time());
+	case TOOLTIP_COMBAT_WIDTH: {
 		static const StringName base_value_combat_width_localisation_key = "COMWID_BASE";
 		String combat_width_tooltip = tr(base_value_combat_width_localisation_key).replace(
 			Utilities::get_short_value_placeholder(), String::num_uint64(
 				type_safe::get(definition_manager.get_define_manager().get_military_defines().get_base_combat_width())
 			)
 		);
-		const fixed_point_t combat_width = country->get_modifier_effect_value(
+		const fixed_point_t combat_width = country.get_modifier_effect_value(
 			*modifier_effect_cache.get_combat_width_additive()
 		);
 		if (combat_width != fixed_point_t::_0) {
-			combat_width_tooltip += from_technology_tooltip + GUILabel::get_colour_marker() + "G" +
+			combat_width_tooltip += "\n" + tr(from_tech_localisation_key) + ": " + GUILabel::get_colour_marker() + "G" +
 				String::num_int64(combat_width.truncate<int64_t>());
 		}
-		ret[military_info_combat_width_tooltip_key] = std::move(combat_width_tooltip);
+		return combat_width_tooltip;
 	}
-
-	ret[military_info_dig_in_cap_key] = country->get_dig_in_cap();
-	ret[military_info_military_tactics_key] = static_cast<real_t>(country->get_military_tactics());
-
-	// Mobilisation
-	static const StringName military_info_is_mobilised_key = "is_mobilised";
-	static const StringName military_info_mobilisation_progress_key = "mobilisation_progress";
-	static const StringName military_info_mobilisation_size_key = "mobilisation_size";
-	static const StringName military_info_mobilisation_size_tooltip_key = "mobilisation_size_tooltip";
-	static const StringName military_info_mobilisation_impact_tooltip_key = "mobilisation_impact_tooltip";
-	static const StringName military_info_mobilisation_economy_impact_key = "mobilisation_economy_impact";
-	static const StringName military_info_mobilisation_economy_impact_tooltip_key = "mobilisation_economy_impact_tooltip";
-
-	ret[military_info_is_mobilised_key] = country->is_mobilised();
-	// TODO - get mobilisation progress from SIM
-	// ret[military_info_mobilisation_progress_key] = static_cast<real_t>(country->get_mobilisation_progress());
-	ret[military_info_mobilisation_size_key] = static_cast<uint64_t>(country->get_mobilisation_potential_regiment_count());
-
-	{
-		static const StringName mobilisation_size_tooltip_localisation_key = "MOB_SIZE_IRO";
-		static const StringName mobilisation_size_tech_tooltip_localisation_key = "MOB_FROM_TECH";
-
-		const fixed_point_t mobilisation_size_from_tech = country->get_modifier_effect_value(
-			*modifier_effect_cache.get_mobilisation_size_tech()
-		);
-
-		String military_info_mobilisation_size_tooltip = tr(mobilisation_size_tooltip_localisation_key).replace(
-			Utilities::get_long_value_placeholder(),
-			Utilities::fixed_point_to_string_dp(
-				(
-					country->get_modifier_effect_value(*modifier_effect_cache.get_mobilisation_size_country()) +
-					mobilisation_size_from_tech
-				) * 100, 2
-			)
+	case TOOLTIP_MOBILISATION_SIZE:
+		/* Mobilisation's impact is only relevant while the country can still mobilise. */
+		return _make_mobilisation_size_tooltip(country) + (
+			country.is_mobilised() ? String {} : "\n\n\n" + _make_mobilisation_impact_tooltip(country)
 		);
+	case TOOLTIP_MOBILISE: {
+		static const StringName mobilise_localisation_key = "MILITARY_MOBILIZE";
+		static const StringName not_enough_for_brigade_localisation_key = "NOT_ENOUGH_FOR_BRIGADE";
+		static const StringName mobilise_description_localisation_key = "MILITARY_MOBILIZE_DESC";
 
-		if (mobilisation_size_from_tech != fixed_point_t::_0) {
-			military_info_mobilisation_size_tooltip += "\n" + tr(mobilisation_size_tech_tooltip_localisation_key).replace(
-				Utilities::get_long_value_placeholder(),
-				_make_modifier_effect_value_coloured(
-					*modifier_effect_cache.get_mobilisation_size_country(), mobilisation_size_from_tech, false
-				)
-			);
-		}
+		const bool can_mobilise = country.get_mobilisation_potential_regiment_count() > 0;
 
-		military_info_mobilisation_size_tooltip += _make_modifier_effect_contributions_tooltip(
-			*country, *modifier_effect_cache.get_mobilisation_size_country()
-		);
-
-		ret[military_info_mobilisation_size_tooltip_key] = std::move(military_info_mobilisation_size_tooltip);
-	}
-
-	if (!country->is_mobilised()) {
-		ret[military_info_mobilisation_impact_tooltip_key] = _make_mobilisation_impact_tooltip();
+		return tr(mobilise_localisation_key) + "\n" + _make_mobilisation_size_tooltip(country) + (
+			can_mobilise ? String { "\n\n\n" } : "\n\n" + tr(not_enough_for_brigade_localisation_key) + "\n\n"
+		) + _make_mobilisation_impact_tooltip(country) + get_tooltip_separator() + tr(mobilise_description_localisation_key);
 	}
-
-	ret[military_info_mobilisation_economy_impact_key] = static_cast<real_t>(country->get_mobilisation_economy_impact());
-
-	{
+	case TOOLTIP_MOBILISATION_ECONOMY_IMPACT: {
 		String mobilisation_economy_impact_tooltip = _make_modifier_effect_contributions_tooltip(
-			*country, *modifier_effect_cache.get_mobilisation_economy_impact_country()
+			country, *modifier_effect_cache.get_mobilisation_economy_impact_country()
 		);
 
-		const fixed_point_t research_contribution = country->get_modifier_effect_value(
+		const fixed_point_t research_contribution = country.get_modifier_effect_value(
 			*modifier_effect_cache.get_mobilisation_economy_impact_tech()
 		);
 
@@ -580,8 +524,113 @@ Dictionary MenuSingleton::get_military_menu_info() {
 			mobilisation_economy_impact_tooltip = mobilisation_economy_impact_tooltip.substr(1);
 		}
 
-		ret[military_info_mobilisation_economy_impact_tooltip_key] = mobilisation_economy_impact_tooltip;
+		return mobilisation_economy_impact_tooltip;
+	}
+	default:
+		ERR_FAIL_V_MSG({}, Utilities::format("Invalid military stat tooltip kind: %d", kind));
 	}
+}
+
+Dictionary MenuSingleton::get_military_menu_info() {
+	cached_leader_dicts.clear();
+
+	GameSingleton const* game_singleton = GameSingleton::get_singleton();
+	ERR_FAIL_NULL_V(game_singleton, {});
+
+	DefinitionManager const& definition_manager = game_singleton->get_definition_manager();
+	IssueManager const& issue_manager = definition_manager.get_politics_manager().get_issue_manager();
+
+	CountryInstance const* country = PlayerSingleton::get_singleton()->get_player_country();
+	if (country == nullptr) {
+		return {};
+	}
+
+	Dictionary ret;
+
+	// Military stats
+	static const StringName military_info_war_exhaustion_key = "war_exhaustion";
+	static const StringName military_info_war_exhaustion_tooltip_id_key = "war_exhaustion_tooltip_id";
+	static const StringName military_info_supply_consumption_key = "supply_consumption";
+	static const StringName military_info_supply_consumption_tooltip_id_key = "supply_consumption_tooltip_id";
+	static const StringName military_info_organisation_regain_key = "organisation_regain";
+	static const StringName military_info_organisation_regain_tooltip_id_key = "organisation_regain_tooltip_id";
+	static const StringName military_info_land_organisation_key = "land_organisation";
+	static const StringName military_info_land_organisation_tooltip_id_key = "land_organisation_tooltip_id";
+	static const StringName military_info_naval_organisation_key = "naval_organisation";
+	static const StringName military_info_naval_organisation_tooltip_id_key = "naval_organisation_tooltip_id";
+	static const StringName military_info_land_unit_start_experience_key = "land_unit_start_experience";
+	static const StringName military_info_naval_unit_start_experience_key = "naval_unit_start_experience";
+	static const StringName military_info_unit_start_experience_tooltip_id_key = "unit_start_experience_tooltip_id";
+	static const StringName military_info_recruit_time_key = "recruit_time";
+	static const StringName military_info_recruit_time_tooltip_id_key = "recruit_time_tooltip_id";
+	static const StringName military_info_combat_width_key = "combat_width";
+	static const StringName military_info_combat_width_tooltip_id_key = "combat_width_tooltip_id";
+	static const StringName military_info_dig_in_cap_key = "dig_in_cap";
+	static const StringName military_info_military_tactics_key = "military_tactics";
+
+	/* The tooltips are only generated when shown, see get_tooltip_text. */
+	const int32_t country_tooltip_target = type_safe::get(country->country_definition.index);
+
+	static const String war_exhaustion_template_string = "%s/%s";
+	ret[military_info_war_exhaustion_key] = Utilities::format(
+		war_exhaustion_template_string, Utilities::fixed_point_to_string_dp(country->get_war_exhaustion(), 2),
+		Utilities::fixed_point_to_string_dp(country->get_war_exhaustion_max(), 2)
+	);
+	ret[military_info_war_exhaustion_tooltip_id_key] = make_tooltip_id(TOOLTIP_WAR_EXHAUSTION, country_tooltip_target);
+
+	ret[military_info_supply_consumption_key] = static_cast<real_t>(country->get_supply_consumption());
+	ret[military_info_supply_consumption_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_SUPPLY_CONSUMPTION, country_tooltip_target);
+
+	ret[military_info_organisation_regain_key] = static_cast<real_t>(country->get_organisation_regain());
+	ret[military_info_organisation_regain_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_ORGANISATION_REGAIN, country_tooltip_target);
+
+	ret[military_info_land_organisation_key] = static_cast<real_t>(country->get_land_organisation());
+	ret[military_info_land_organisation_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_LAND_ORGANISATION, country_tooltip_target);
+
+	ret[military_info_naval_organisation_key] = static_cast<real_t>(country->get_naval_organisation());
+	ret[military_info_naval_organisation_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_NAVAL_ORGANISATION, country_tooltip_target);
+
+	ret[military_info_land_unit_start_experience_key] = static_cast<real_t>(country->get_land_unit_start_experience());
+	ret[military_info_naval_unit_start_experience_key] = static_cast<real_t>(country->get_naval_unit_start_experience());
+	ret[military_info_unit_start_experience_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_UNIT_START_EXPERIENCE, country_tooltip_target);
+
+	ret[military_info_recruit_time_key] = static_cast<real_t>(country->get_recruit_time());
+	ret[military_info_recruit_time_tooltip_id_key] = make_tooltip_id(TOOLTIP_RECRUIT_TIME, country_tooltip_target);
+
+	ret[military_info_combat_width_key] = type_safe::get(country->get_combat_width());
+	ret[military_info_combat_width_tooltip_id_key] = make_tooltip_id(TOOLTIP_COMBAT_WIDTH, country_tooltip_target);
+
+	ret[military_info_dig_in_cap_key] = country->get_dig_in_cap();
+	ret[military_info_military_tactics_key] = static_cast<real_t>(country->get_military_tactics());
+
+	// Mobilisation
+	static const StringName military_info_is_mobilised_key = "is_mobilised";
+	static const StringName military_info_mobilisation_progress_key = "mobilisation_progress";
+	static const StringName military_info_mobilisation_size_key = "mobilisation_size";
+	static const StringName military_info_mobilisation_size_tooltip_id_key = "mobilisation_size_tooltip_id";
+	static const StringName military_info_mobilise_tooltip_id_key = "mobilise_tooltip_id";
+	static const StringName military_info_mobilisation_economy_impact_key = "mobilisation_economy_impact";
+	static const StringName military_info_mobilisation_economy_impact_tooltip_id_key = "mobilisation_economy_impact_tooltip_id";
+
+	ret[military_info_is_mobilised_key] = country->is_mobilised();
+	// TODO - get mobilisation progress from SIM
+	// ret[military_info_mobilisation_progress_key] = static_cast<real_t>(country->get_mobilisation_progress());
+	ret[military_info_mobilisation_size_key] = static_cast<uint64_t>(country->get_mobilisation_potential_regiment_count());
+
+	ret[military_info_mobilisation_size_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_MOBILISATION_SIZE, country_tooltip_target);
+	if (!country->is_mobilised()) {
+		ret[military_info_mobilise_tooltip_id_key] = make_tooltip_id(TOOLTIP_MOBILISE, country_tooltip_target);
+	}
+
+	ret[military_info_mobilisation_economy_impact_key] = static_cast<real_t>(country->get_mobilisation_economy_impact());
+	ret[military_info_mobilisation_economy_impact_tooltip_id_key] =
+		make_tooltip_id(TOOLTIP_MOBILISATION_ECONOMY_IMPACT, country_tooltip_target);
 
 	// Leaders
 	static const StringName military_info_general_count_key = "general_count";
@@ -113,6 +113,7 @@ void PlayerSingleton::set_player_country(CountryInstance* new_player_country) {
 
 	SPDLOG_INFO("Set player country to: {}", ovfmt::validate(player_country));
 
+	player_country_changed();
 	game_singleton._on_gamestate_updated();
 }
 
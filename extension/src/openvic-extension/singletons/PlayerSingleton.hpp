@@ -4,6 +4,7 @@
 
 #include <openvic-simulation/population/PopType.hpp>
 #include <openvic-simulation/types/fixed_point/FixedPoint.hpp>
+#include <openvic-simulation/types/Signal.hpp>
 #include <openvic-simulation/utility/Getters.hpp>
 
 namespace OpenVic {
@@ -26,6 +27,9 @@ namespace OpenVic {
 
 	public:
 		static PlayerSingleton* get_singleton();
+		/* Emitted when the player's country is set, before the resulting gamestate update, so anything built from the
+		 * player's country can be rebuilt before any gamestate_updated handlers read it. */
+		signal_property<PlayerSingleton> player_country_changed;
 
 		PlayerSingleton();
 		~PlayerSingleton();
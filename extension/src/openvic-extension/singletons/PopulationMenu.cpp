@@ -1,8 +1,18 @@
 #include "MenuSingleton.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <span>
+#include <string>
 #include <type_traits>
-
+#include <utility>
+
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/text_server.hpp>
+#include <godot_cpp/classes/text_server_manager.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/translation_server.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <type_safe/strong_typedef.hpp>
 
@@ -20,6 +30,7 @@
 #include "openvic-extension/classes/GUINode.hpp"
 #include "openvic-extension/core/Convert.hpp"
 #include "openvic-extension/singletons/GameSingleton.hpp"
+#include "openvic-extension/singletons/PlayerSingleton.hpp"
 #include "openvic-extension/utility/MapHelpers.hpp"
 #include "openvic-extension/utility/Utilities.hpp"
 
@@ -28,6 +39,76 @@ using namespace OpenVic;
 
 /* POPULATION MENU */
 
+void MenuSingleton::population_menu_t::province_list_blocks_t::clear() {
+	starts.clear();
+	entry_blocks.clear();
+	visible_rows.clear();
+	visible_rows_tree.clear();
+}
+
+void MenuSingleton::population_menu_t::province_list_blocks_t::add_block() {
+	starts.push_back(entry_blocks.size());
+	visible_rows.push_back(1);
+	entry_blocks.push_back(visible_rows.size() - 1);
+}
+
+void MenuSingleton::population_menu_t::province_list_blocks_t::add_entry_to_last_block() {
+	entry_blocks.push_back(visible_rows.size() - 1);
+}
+
+void MenuSingleton::population_menu_t::province_list_blocks_t::build_tree() {
+	starts.push_back(entry_blocks.size());
+
+	/* The tree is 1-indexed, each node holding the sum of the (node & -node) blocks ending at it. */
+	const int32_t block_count = visible_rows.size();
+	visible_rows_tree.assign(block_count + 1, 0);
+	for (int32_t node = 1; node <= block_count; ++node) {
+		visible_rows_tree[node] += visible_rows[node - 1];
+		const int32_t parent = node + (node & -node);
+		if (parent <= block_count) {
+			visible_rows_tree[parent] += visible_rows_tree[node];
+		}
+	}
+}
+
+void MenuSingleton::population_menu_t::province_list_blocks_t::set_visible_rows(int32_t block, int32_t rows) {
+	const int32_t delta = rows - visible_rows[block];
+	visible_rows[block] = rows;
+
+	const int32_t block_count = visible_rows.size();
+	for (int32_t node = block + 1; node <= block_count; node += node & -node) {
+		visible_rows_tree[node] += delta;
+	}
+}
+
+int32_t MenuSingleton::population_menu_t::province_list_blocks_t::get_visible_rows_before(int32_t block) const {
+	int32_t rows = 0;
+	for (int32_t node = block; node > 0; node -= node & -node) {
+		rows += visible_rows_tree[node];
+	}
+	return rows;
+}
+
+std::pair<int32_t, int32_t> MenuSingleton::population_menu_t::province_list_blocks_t::find_visible_row(int32_t row) const {
+	const int32_t block_count = visible_rows.size();
+
+	int32_t step = 1;
+	while (step * 2 <= block_count) {
+		step *= 2;
+	}
+
+	/* Find the number of whole blocks ending at or before row, which is also the index of the block containing it. */
+	int32_t block = 0, remaining_rows = row;
+	for (; step > 0; step /= 2) {
+		if (block + step <= block_count && visible_rows_tree[block + step] <= remaining_rows) {
+			block += step;
+			remaining_rows -= visible_rows_tree[block];
+		}
+	}
+
+	return { block, row - remaining_rows };
+}
+
 Error MenuSingleton::_population_menu_update_provinces() {
 	GameSingleton const* game_singleton = GameSingleton::get_singleton();
 	ERR_FAIL_NULL_V(game_singleton, FAILED);
@@ -35,33 +116,56 @@ Error MenuSingleton::_population_menu_update_provinces() {
 	ERR_FAIL_NULL_V(instance_manager, FAILED);
 
 	population_menu.province_list_entries.clear();
+	population_menu.province_list_blocks.clear();
+	/* The province sort cache refers to the previous session's provinces. */
+	population_menu.sort_cache_locale = {};
 	population_menu.visible_province_list_entries = 0;
 	ERR_FAIL_COND_V(_population_menu_generate_pop_filters() != OK, FAILED);
 
 	MapInstance const& map_instance = instance_manager->get_map_instance();
 
-	for (CountryInstance const* country : {
-		// Example country
-		instance_manager->get_country_instance_manager().get_country_instance_by_identifier("ENG")
-	}) {
-		ERR_CONTINUE(country == nullptr);
+	/* Countries listed in the menu, each followed by the states it owns. Only the player's country is listed, and the list
+	 * is left empty while there isn't one. */
+	ordered_map<CountryInstance const*, std::vector<State const*>> states_by_country;
 
-		population_menu.province_list_entries.emplace_back(population_menu_t::country_entry_t { *country });
-		population_menu.visible_province_list_entries++;
+	PlayerSingleton const* player_singleton = PlayerSingleton::get_singleton();
+	ERR_FAIL_NULL_V(player_singleton, FAILED);
+	CountryInstance const* player_country = player_singleton->get_player_country();
 
-		for (StateSet const& state_set : map_instance.get_state_manager().get_state_sets()) {
-			for (State const& state : state_set.get_states()) {
+	if (player_country != nullptr) {
+		states_by_country[player_country];
+	}
 
-				population_menu.province_list_entries.emplace_back(population_menu_t::state_entry_t { state });
-				population_menu.visible_province_list_entries++;
+	for (StateSet const& state_set : map_instance.get_state_manager().get_state_sets()) {
+		for (State const& state : state_set.get_states()) {
+			const decltype(states_by_country)::iterator it = states_by_country.find(state.get_owner());
 
-				for (ProvinceInstance const& province : state.get_provinces()) {
-					population_menu.province_list_entries.emplace_back(population_menu_t::province_entry_t { province });
-				}
+			if (it != states_by_country.end()) {
+				it.value().push_back(&state);
 			}
 		}
 	}
 
+	population_menu_t::province_list_blocks_t& blocks = population_menu.province_list_blocks;
+
+	for (auto const& [country, states] : states_by_country) {
+		population_menu.province_list_entries.emplace_back(population_menu_t::country_entry_t { *country });
+		blocks.add_block();
+
+		for (State const* state : states) {
+			population_menu.province_list_entries.emplace_back(population_menu_t::state_entry_t { *state });
+			blocks.add_block();
+
+			for (ProvinceInstance const& province : state->get_provinces()) {
+				population_menu.province_list_entries.emplace_back(population_menu_t::province_entry_t { province });
+				blocks.add_entry_to_last_block();
+			}
+		}
+	}
+
+	blocks.build_tree();
+	population_menu.visible_province_list_entries = blocks.visible_rows.size();
+
 	population_menu.sort_key = SORT_NONE;
 
 	emit_signal(_signal_population_menu_province_list_changed());
@@ -101,87 +205,71 @@ TypedArray<Dictionary> MenuSingleton::get_population_menu_province_list_rows(int
 
 		MenuSingleton const& menu_singleton;
 
-		int32_t& start_counter;
-		int32_t& count_counter;
-
 		/* This is the index among all entries, not just visible ones unlike start and count. */
 		int32_t index = 0;
 
-		bool is_expanded = true;
-
-		TypedArray<Dictionary> array;
+		Dictionary operator()(population_menu_t::country_entry_t const& country_entry) const {
+			Dictionary country_dict;
 
-		/* Overloads return false if count_counter reaches 0 and the function should return,
-		 * otherwise true indicating the province list loop should continue. */
-
-		bool operator()(population_menu_t::country_entry_t const& country_entry) {
-			if (start_counter-- <= 0) {
-				Dictionary country_dict;
-
-				country_dict[type_key] = LIST_ENTRY_COUNTRY;
-				country_dict[index_key] = index;
-				country_dict[name_key] = Utilities::get_country_name(menu_singleton, country_entry.country);
-				country_dict[size_key] = type_safe::get(country_entry.country.get_total_population());
-				country_dict[change_key] = 0;
-				country_dict[selected_key] = country_entry.selected;
-
-				array.push_back(country_dict);
-
-				return --count_counter > 0;
-			}
+			country_dict[type_key] = LIST_ENTRY_COUNTRY;
+			country_dict[index_key] = index;
+			country_dict[name_key] = Utilities::get_country_name(menu_singleton, country_entry.country);
+			country_dict[size_key] = type_safe::get(country_entry.country.get_total_population());
+			country_dict[change_key] = 0;
+			country_dict[selected_key] = country_entry.selected;
 
-			return true;
+			return country_dict;
 		}
 
-		bool operator()(population_menu_t::state_entry_t const& state_entry) {
-			is_expanded = state_entry.expanded;
+		Dictionary operator()(population_menu_t::state_entry_t const& state_entry) const {
+			Dictionary state_dict;
 
-			if (start_counter-- <= 0) {
-				Dictionary state_dict;
+			state_dict[type_key] = LIST_ENTRY_STATE;
+			state_dict[index_key] = index;
+			state_dict[name_key] = Utilities::get_state_name(menu_singleton, state_entry.state);
+			state_dict[size_key] = type_safe::get(state_entry.state.get_total_population());
+			state_dict[change_key] = 0;
+			state_dict[selected_key] = state_entry.selected;
+			state_dict[expanded_key] = state_entry.expanded;
+			state_dict[colonial_status_key] = false;
 
-				state_dict[type_key] = LIST_ENTRY_STATE;
-				state_dict[index_key] = index;
-				state_dict[name_key] = Utilities::get_state_name(menu_singleton, state_entry.state);
-				state_dict[size_key] = type_safe::get(state_entry.state.get_total_population());
-				state_dict[change_key] = 0;
-				state_dict[selected_key] = state_entry.selected;
-				state_dict[expanded_key] = state_entry.expanded;
-				state_dict[colonial_status_key] = false;
+			return state_dict;
+		}
 
-				array.push_back(state_dict);
+		Dictionary operator()(population_menu_t::province_entry_t const& province_entry) const {
+			Dictionary province_dict;
 
-				return --count_counter > 0;
-			}
+			province_dict[type_key] = LIST_ENTRY_PROVINCE;
+			province_dict[index_key] = index;
+			province_dict[name_key] = convert_to<String>(province_entry.province.get_identifier());
+			province_dict[size_key] = type_safe::get(province_entry.province.get_total_population());
+			province_dict[change_key] = 0;
+			province_dict[selected_key] = province_entry.selected;
 
-			return true;
+			return province_dict;
 		}
+	} entry_visitor { *this };
 
-		bool operator()(population_menu_t::province_entry_t const& province_entry) {
-			if (is_expanded && start_counter-- <= 0) {
-				Dictionary province_dict;
+	population_menu_t::province_list_blocks_t const& blocks = population_menu.province_list_blocks;
+	const int32_t block_count = blocks.visible_rows.size();
 
-				province_dict[type_key] = LIST_ENTRY_PROVINCE;
-				province_dict[index_key] = index;
-				province_dict[name_key] = convert_to<String>(province_entry.province.get_identifier());
-				province_dict[size_key] = type_safe::get(province_entry.province.get_total_population());
-				province_dict[change_key] = 0;
-				province_dict[selected_key] = province_entry.selected;
+	/* Rows within a block are its first entry followed by its province entries, if the block is expanded. */
+	auto [block, rows_before_block] = blocks.find_visible_row(start);
+	int32_t block_row = start - rows_before_block;
 
-				array.push_back(province_dict);
+	TypedArray<Dictionary> array;
 
-				return --count_counter > 0;
-			}
+	while (count-- > 0 && block < block_count) {
+		entry_visitor.index = blocks.starts[block] + block_row;
+		array.push_back(std::visit(entry_visitor, population_menu.province_list_entries[entry_visitor.index]));
 
-			return true;
+		if (++block_row >= blocks.visible_rows[block]) {
+			block++;
+			block_row = 0;
 		}
-	} entry_visitor { *this, start, count };
-
-	while (entry_visitor.index < population_menu.province_list_entries.size()
-		&& std::visit(entry_visitor, population_menu.province_list_entries[entry_visitor.index])) {
-		entry_visitor.index++;
 	}
 
-	return entry_visitor.array;
+	return array;
 }
 
 Error MenuSingleton::population_menu_select_province_list_entry(int32_t select_index, bool set_scroll_index) {
@@ -191,10 +279,7 @@ Error MenuSingleton::population_menu_select_province_list_entry(int32_t select_i
 
 		const int32_t _select_index = 0;
 
-		int32_t index = 0, visible_index = 0;
-		bool is_expanded = true;
-
-		int32_t selected_visible_index = -1;
+		int32_t index = 0;
 
 		ProvinceListEntry select_level = LIST_ENTRY_NONE;
 
@@ -203,15 +288,11 @@ Error MenuSingleton::population_menu_select_province_list_entry(int32_t select_i
 				select_level = LIST_ENTRY_COUNTRY;
 
 				country_entry.selected = true;
-
-				selected_visible_index = visible_index;
 			} else {
 				select_level = LIST_ENTRY_NONE;
 
 				country_entry.selected = false;
 			}
-
-			visible_index++;
 		}
 
 		void operator()(population_menu_t::state_entry_t& state_entry) {
@@ -221,16 +302,10 @@ Error MenuSingleton::population_menu_select_province_list_entry(int32_t select_i
 				select_level = LIST_ENTRY_STATE;
 
 				state_entry.selected = true;
-
-				selected_visible_index = visible_index;
 			} else {
 				select_level = LIST_ENTRY_NONE;
 				state_entry.selected = false;
 			}
-
-			visible_index++;
-
-			is_expanded = state_entry.expanded;
 		}
 
 		void operator()(population_menu_t::province_entry_t& province_entry) {
@@ -238,15 +313,9 @@ Error MenuSingleton::population_menu_select_province_list_entry(int32_t select_i
 				province_entry.selected = true;
 			} else if (index == _select_index) {
 				province_entry.selected = true;
-
-				selected_visible_index = visible_index;
 			} else {
 				province_entry.selected = false;
 			}
-
-			if (is_expanded) {
-				visible_index++;
-			}
 		}
 
 	} entry_visitor { select_index };
@@ -256,10 +325,17 @@ Error MenuSingleton::population_menu_select_province_list_entry(int32_t select_i
 		entry_visitor.index++;
 	}
 
-	emit_signal(
-		_signal_population_menu_province_list_selected_changed(),
-		set_scroll_index ? entry_visitor.selected_visible_index : -1
-	);
+	int32_t selected_visible_index = -1;
+	if (set_scroll_index) {
+		population_menu_t::province_list_blocks_t const& blocks = population_menu.province_list_blocks;
+		const int32_t block = blocks.entry_blocks[select_index];
+
+		/* A province in a collapsed state scrolls to its state's row, the only visible row in its block. */
+		selected_visible_index = blocks.get_visible_rows_before(block)
+			+ std::min(select_index - blocks.starts[block], blocks.visible_rows[block] - 1);
+	}
+
+	emit_signal(_signal_population_menu_province_list_selected_changed(), selected_visible_index);
 
 	return _population_menu_update_pops();
 }
@@ -340,12 +416,9 @@ Error MenuSingleton::population_menu_toggle_expanded(int32_t toggle_index, bool
 
 	ERR_FAIL_NULL_V_MSG(state_entry, FAILED, Utilities::format("Cannot toggle expansion of a non-state entry! (%d)", toggle_index));
 
-	int32_t provinces = 0;
-
-	while (++toggle_index < population_menu.province_list_entries.size()
-		&& std::holds_alternative<population_menu_t::province_entry_t>(population_menu.province_list_entries[toggle_index])) {
-		provinces++;
-	}
+	population_menu_t::province_list_blocks_t& blocks = population_menu.province_list_blocks;
+	const int32_t block = blocks.entry_blocks[toggle_index];
+	const int32_t provinces = blocks.starts[block + 1] - blocks.starts[block] - 1;
 
 	if (state_entry->expanded) {
 		state_entry->expanded = false;
@@ -355,6 +428,8 @@ Error MenuSingleton::population_menu_toggle_expanded(int32_t toggle_index, bool
 		population_menu.visible_province_list_entries += provinces;
 	}
 
+	blocks.set_visible_rows(block, state_entry->expanded ? provinces + 1 : 1);
+
 	emit_signal(_signal_population_menu_province_list_changed());
 
 	if (emit_selected_changed) {
@@ -364,12 +439,65 @@ Error MenuSingleton::population_menu_toggle_expanded(int32_t toggle_index, bool
 	return OK;
 }
 
-Error MenuSingleton::_population_menu_update_pops() {
-	for (auto [pop_type, filter] : mutable_iterator(population_menu.pop_filters)) {
-		filter.count = 0;
-		filter.promotion_demotion_change = 0;
+/* Compares every selected province's pops against pops by address, so any pop being added, removed or moved between
+ * provinces since they were collected is caught. */
+bool MenuSingleton::_population_menu_pops_changed() const {
+	size_t pop_index = 0;
+
+	for (population_menu_t::province_list_entry_t const& entry : population_menu.province_list_entries) {
+		population_menu_t::province_entry_t const* province_entry = std::get_if<population_menu_t::province_entry_t>(&entry);
+
+		if (province_entry != nullptr && province_entry->selected) {
+			for (Pop const& pop : province_entry->province.get_pops()) {
+				if (pop_index >= population_menu.pops.size() || &population_menu.pops[pop_index].get() != &pop) {
+					return true;
+				}
+				++pop_index;
+			}
+		}
 	}
 
+	return pop_index != population_menu.pops.size();
+}
+
+/* Look each pop type's filter up once rather than once per pop. */
+static std::vector<bool> population_menu_pop_type_selected(
+	ordered_map<PopType const*, MenuSingleton::population_menu_t::pop_filter_t> const& pop_filters
+) {
+	TypedSpan<pop_type_index_t, const PopType> pop_types = GameSingleton::get_singleton()->get_pop_types();
+
+	std::vector<bool> pop_type_selected(type_safe::get(pop_types.size()));
+	for (pop_type_index_t index {}; index < pop_types.size(); ++index) {
+		const decltype(pop_filters)::const_iterator it = pop_filters.find(&pop_types[index]);
+		pop_type_selected[type_safe::get(index)] = it != pop_filters.end() && it->second.selected;
+	}
+	return pop_type_selected;
+}
+
+/* Whether filtered_pops no longer holds exactly the pops whose types pass the filters. Only meaningful while pops is
+ * unchanged, in which case filtered_pops' pops are all distinct members of pops, so matching the number of pops passing the
+ * filters and every filtered pop passing them means the sets match. */
+bool MenuSingleton::_population_menu_filtered_pops_changed() const {
+	const std::vector<bool> pop_type_selected = population_menu_pop_type_selected(population_menu.pop_filters);
+
+	size_t selected_count = 0;
+	for (Pop const& pop : population_menu.pops) {
+		selected_count += pop_type_selected[type_safe::get(pop.get_type().index)];
+	}
+	if (selected_count != population_menu.filtered_pops.size()) {
+		return true;
+	}
+
+	for (Pop const& pop : population_menu.filtered_pops) {
+		if (!pop_type_selected[type_safe::get(pop.get_type().index)]) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void MenuSingleton::_population_menu_collect_pops() {
 	population_menu.pops.clear();
 
 	for (int32_t index = 0; index < population_menu.province_list_entries.size(); index++) {
@@ -379,96 +507,203 @@ Error MenuSingleton::_population_menu_update_pops() {
 		if (province_entry != nullptr && province_entry->selected) {
 			for (Pop const& pop : province_entry->province.get_pops()) {
 				population_menu.pops.push_back(pop);
-				population_menu_t::pop_filter_t& filter = population_menu.pop_filters[&pop.get_type()];
-				filter.count += pop.get_size();
-				// TODO - set filter.promotion_demotion_change
 			}
 		}
 	}
 
+	_population_menu_update_pop_filter_counts();
+}
+
+void MenuSingleton::_population_menu_update_pop_filter_counts() {
+	for (auto [pop_type, filter] : mutable_iterator(population_menu.pop_filters)) {
+		filter.count = 0;
+		filter.promotion_demotion_change = 0;
+	}
+
+	for (Pop const& pop : population_menu.pops) {
+		population_menu_t::pop_filter_t& filter = population_menu.pop_filters[&pop.get_type()];
+		filter.count += pop.get_size();
+		// TODO - set filter.promotion_demotion_change
+	}
+}
+
+Error MenuSingleton::_population_menu_update_pops() {
+	_population_menu_collect_pops();
+
 	return _population_menu_update_filtered_pops();
 }
 
-Error MenuSingleton::_population_menu_update_filtered_pops() {
-	population_menu.filtered_pops.clear();
+/* Below this many filtered pops the distributions are summed on the calling thread, as a single chunk. */
+static constexpr size_t POPULATION_MENU_MIN_POPS_PER_CHUNK = 2048;
 
-	fixed_point_t workforce_distribution_running_total = 0;
-	fixed_point_t ideology_distribution_running_total = 0;
+static size_t population_menu_chunk_start(size_t pop_count, size_t chunk_count, size_t chunk_index) {
+	return pop_count * chunk_index / chunk_count;
+}
 
-	population_menu.workforce_distribution.clear();
-	population_menu.religion_distribution.clear();
-	population_menu.ideology_distribution.clear();
-	population_menu.culture_distribution.clear();
-	population_menu.issue_distribution.clear();
-	population_menu.vote_distribution.clear();
+/* Religion and culture totals are indexed by position in the definition manager's lists, which are contiguous. */
+static std::span<const Culture> population_menu_cultures() {
+	return GameSingleton::get_singleton()->get_definition_manager().get_pop_manager().get_culture_manager().get_cultures();
+}
+static std::span<const Religion> population_menu_religions() {
+	return GameSingleton::get_singleton()->get_definition_manager().get_pop_manager().get_religion_manager().get_religions();
+}
 
-	for (Pop const& pop : population_menu.pops) {
-		if (population_menu.pop_filters[&pop.get_type()].selected) {
-			population_menu.filtered_pops.push_back(pop);
+template<typename KeyType>
+static void population_menu_set_distribution(
+	MenuSingleton::population_menu_t::distribution_t<KeyType>& distribution, std::span<const KeyType> keys,
+	std::vector<fixed_point_t> const& totals
+) {
+	distribution.keys.clear();
+	distribution.values.clear();
+
+	fixed_point_t total = 0;
+	for (size_t index = 0; index < keys.size(); ++index) {
+		if (totals[index] > 0) {
+			distribution.keys.push_back(&keys[index]);
+			distribution.values.push_back(totals[index]);
+			total += totals[index];
 		}
 	}
 
-	for (Pop const& pop : population_menu.filtered_pops) {
+	if (total > 0) {
+		for (fixed_point_t& value : distribution.values) {
+			value /= total;
+		}
+	}
+}
+
+void MenuSingleton::_population_menu_aggregate_pops(uint32_t chunk_index) {
+	population_menu_t::pop_aggregate_t& aggregate = population_menu.pop_aggregates[chunk_index];
+
+	std::fill(aggregate.workforce.begin(), aggregate.workforce.end(), fixed_point_t::_0);
+	std::fill(aggregate.religion.begin(), aggregate.religion.end(), fixed_point_t::_0);
+	std::fill(aggregate.ideology.begin(), aggregate.ideology.end(), fixed_point_t::_0);
+	std::fill(aggregate.culture.begin(), aggregate.culture.end(), fixed_point_t::_0);
+	aggregate.vote.clear();
+
+	Culture const* const first_culture = population_menu_cultures().data();
+	Religion const* const first_religion = population_menu_religions().data();
+
+	const size_t pop_count = population_menu.filtered_pops.size();
+	const size_t chunk_count = population_menu.pop_aggregates.size();
+	const size_t end = population_menu_chunk_start(pop_count, chunk_count, chunk_index + 1);
+
+	for (size_t index = population_menu_chunk_start(pop_count, chunk_count, chunk_index); index < end; ++index) {
+		Pop const& pop = population_menu.filtered_pops[index];
 		const fixed_point_t pop_size = fixed_point_t(type_safe::get(pop.get_size()));
 
-		population_menu.workforce_distribution[&pop.get_type()] += pop_size;
-		population_menu.religion_distribution[&pop.religion] += pop_size;
+		aggregate.workforce[type_safe::get(pop.get_type().index)] += pop_size;
+		aggregate.religion[&pop.religion - first_religion] += pop_size;
 		{
-			ideology_index_t ideology_index {};
+			size_t ideology_index = 0;
 			for (const fixed_point_t supporter_equivalents : pop.get_supporter_equivalents_by_ideology()) {
 				if (supporter_equivalents > 0) {
-					population_menu.ideology_distribution[&GameSingleton::get_singleton()->get_ideology(ideology_index)] += supporter_equivalents;
-					ideology_distribution_running_total += supporter_equivalents;
+					aggregate.ideology[ideology_index] += supporter_equivalents;
 				}
 				++ideology_index;
 			}
 		}
-		population_menu.culture_distribution[&pop.culture] += pop_size;
-		{
-			party_policy_index_t party_policy_index {};
-			for(const fixed_point_t party_policy_support : pop.get_supporter_equivalents_by_party_policy()) {
-				population_menu.issue_distribution[&GameSingleton::get_singleton()->get_party_policy(party_policy_index)];
-				++party_policy_index;
-			}
-		}
-		{
-			reform_index_t reform_index {};
-			for(const fixed_point_t reform_support : pop.get_supporter_equivalents_by_reform()) {
-				population_menu.issue_distribution[&GameSingleton::get_singleton()->get_reform(reform_index)];
-				++reform_index;
-			}
+		aggregate.culture[&pop.culture - first_culture] += pop_size;
+		aggregate.vote += pop.get_vote_equivalents_by_party();
+	}
+}
+
+void MenuSingleton::_population_menu_filter_pops() {
+	population_menu.filtered_pops.clear();
+
+	const std::vector<bool> pop_type_selected = population_menu_pop_type_selected(population_menu.pop_filters);
+
+	for (Pop const& pop : population_menu.pops) {
+		if (pop_type_selected[type_safe::get(pop.get_type().index)]) {
+			population_menu.filtered_pops.push_back(pop);
 		}
-		population_menu.vote_distribution += pop.get_vote_equivalents_by_party();
 	}
+}
 
-	normalise_fixed_point_map(population_menu.workforce_distribution);
-	normalise_fixed_point_map(population_menu.religion_distribution);
-	normalise_fixed_point_map(population_menu.ideology_distribution);
-	normalise_fixed_point_map(population_menu.culture_distribution);
-	normalise_fixed_point_map(population_menu.issue_distribution);
-	normalise_fixed_point_map(population_menu.vote_distribution);
+Error MenuSingleton::_population_menu_update_filtered_pops() {
+	ERR_FAIL_NULL_V(GameSingleton::get_singleton(), FAILED);
+
+	_population_menu_filter_pops();
+
+	ERR_FAIL_COND_V(_population_menu_update_distributions() != OK, FAILED);
 
 	return _population_menu_sort_pops();
 }
 
-template<typename T>
-static bool indexed_map_lookup_less_than(IndexedFlatMap<T, size_t> const& map, T const& lhs, T const& rhs) {
-	return map.at(lhs) < map.at(rhs);
-}
+Error MenuSingleton::_population_menu_update_distributions() {
+	GameSingleton* game_singleton = GameSingleton::get_singleton();
+	ERR_FAIL_NULL_V(game_singleton, FAILED);
 
-template<typename T>
-static bool indexed_map_lookup_less_than(IndexedFlatMap<T, size_t> const& map, T const* lhs, T const* rhs) {
-	return lhs != nullptr && rhs != nullptr && map.at(*lhs) < map.at(*rhs);
-}
+	TypedSpan<pop_type_index_t, const PopType> pop_types = game_singleton->get_pop_types();
+	TypedSpan<ideology_index_t, const Ideology> ideologies = game_singleton->get_ideologies();
+	const std::span<const Religion> religions = population_menu_religions();
+	const std::span<const Culture> cultures = population_menu_cultures();
 
-template<typename T>
-static bool ordered_map_lookup_less_than(ordered_map<T const*, size_t> const& map, T const& lhs, T const& rhs) {
-	return map.at(&lhs) < map.at(&rhs);
-}
+	const size_t chunk_count = std::clamp<size_t>(
+		population_menu.filtered_pops.size() / POPULATION_MENU_MIN_POPS_PER_CHUNK, 1, OS::get_singleton()->get_processor_count()
+	);
+
+	population_menu.pop_aggregates.resize(chunk_count);
+	for (population_menu_t::pop_aggregate_t& aggregate : population_menu.pop_aggregates) {
+		aggregate.workforce.resize(type_safe::get(pop_types.size()));
+		aggregate.religion.resize(religions.size());
+		aggregate.ideology.resize(type_safe::get(ideologies.size()));
+		aggregate.culture.resize(cultures.size());
+	}
+
+	WorkerThreadPool* worker_thread_pool = WorkerThreadPool::get_singleton();
+	if (chunk_count > 1 && worker_thread_pool != nullptr) {
+		const WorkerThreadPool::GroupID group_id = worker_thread_pool->add_group_task(
+			callable_mp(this, &MenuSingleton::_population_menu_aggregate_pops), chunk_count, -1, true,
+			"Aggregate population menu pops"
+		);
+		worker_thread_pool->wait_for_group_task_completion(group_id);
+	} else {
+		for (uint32_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+			_population_menu_aggregate_pops(chunk_index);
+		}
+	}
+
+	const auto add_totals = [](std::vector<fixed_point_t>& merged_totals, std::vector<fixed_point_t> const& chunk_totals) {
+		for (size_t index = 0; index < merged_totals.size(); ++index) {
+			merged_totals[index] += chunk_totals[index];
+		}
+	};
+
+	/* Chunks are merged into the first, in order, so the vote distribution keeps the order parties are first found in. */
+	population_menu_t::pop_aggregate_t& totals = population_menu.pop_aggregates.front();
+	population_menu.vote_distribution = std::move(totals.vote);
+	for (size_t chunk_index = 1; chunk_index < chunk_count; ++chunk_index) {
+		population_menu_t::pop_aggregate_t const& aggregate = population_menu.pop_aggregates[chunk_index];
+
+		add_totals(totals.workforce, aggregate.workforce);
+		add_totals(totals.religion, aggregate.religion);
+		add_totals(totals.ideology, aggregate.ideology);
+		add_totals(totals.culture, aggregate.culture);
+		population_menu.vote_distribution += aggregate.vote;
+	}
 
-template<typename T>
-static bool ordered_map_lookup_less_than(ordered_map<T const*, size_t> const& map, T const* lhs, T const* rhs) {
-	return lhs != nullptr && rhs != nullptr && map.at(lhs) < map.at(rhs);
+	population_menu_set_distribution<PopType>(population_menu.workforce_distribution, pop_types, totals.workforce);
+	population_menu_set_distribution<Religion>(population_menu.religion_distribution, religions, totals.religion);
+	population_menu_set_distribution<Ideology>(population_menu.ideology_distribution, ideologies, totals.ideology);
+	population_menu_set_distribution<Culture>(population_menu.culture_distribution, cultures, totals.culture);
+
+	population_menu.issue_distribution.clear();
+	if (!population_menu.filtered_pops.empty()) {
+		/* Every issue has an entry once there is at least one pop, as each pop has a supporter equivalent for every
+		 * issue. */
+		for (PartyPolicy const& party_policy : game_singleton->get_party_policies()) {
+			population_menu.issue_distribution[&party_policy];
+		}
+		for (Reform const& reform : game_singleton->get_reforms()) {
+			population_menu.issue_distribution[&reform];
+		}
+	}
+
+	normalise_fixed_point_map(population_menu.issue_distribution);
+	normalise_fixed_point_map(population_menu.vote_distribution);
+
+	return OK;
 }
 
 template<typename KeyType, typename ValueType>
@@ -484,269 +719,437 @@ static ordered_map<KeyType const*, ValueType> copy_non_default_to_ordered_map(In
 	return result;
 }
 
-static bool sort_by_ideologies_less_than(
-	TypedSpan<ideology_index_t, const fixed_point_t> lhs,
-	TypedSpan<ideology_index_t, const fixed_point_t> rhs
+/* Key for sorting pops by their most supported ideology or issue: later ideologies or issues sort first, then pops sort by
+ * how much they support it. Issues are indexed with party policies first, followed by reforms. */
+static std::pair<int64_t, fixed_point_t> make_max_support_sort_key(
+	std::span<const fixed_point_t> supports, std::span<const fixed_point_t> extra_supports = {}
 ) {
-	assert(lhs.size() == rhs.size());
-	ideology_index_t index_of_lhs_max {}, index_of_rhs_max {};
-	fixed_point_t lhs_max = fixed_point_t::usable_min, rhs_max = fixed_point_t::usable_min;
-	for (ideology_index_t i {}; i < lhs.size(); ++i) {
-		const fixed_point_t lhs_v = lhs[i];
-		if (lhs_v > lhs_max) {
-			index_of_lhs_max = i;
-			lhs_max = lhs_v;
-		}
-		const fixed_point_t rhs_v = rhs[i];
-		if (rhs_v > rhs_max) {
-			index_of_rhs_max = i;
-			rhs_max = rhs_v;
+	int64_t index_of_max = 0, index = 0;
+	fixed_point_t max = fixed_point_t::usable_min;
+
+	for (std::span<const fixed_point_t> span : { supports, extra_supports }) {
+		for (const fixed_point_t value : span) {
+			if (value > max) {
+				index_of_max = index;
+				max = value;
+			}
+			++index;
 		}
 	}
 
-	return index_of_lhs_max > index_of_rhs_max || rhs_max > lhs_max;
+	return { -index_of_max, max };
 }
 
-static bool sort_by_issues_less_than(
-	TypedSpan<party_policy_index_t, const fixed_point_t> lhs_party_policies,
-	TypedSpan<party_policy_index_t, const fixed_point_t> rhs_party_policies,
-	TypedSpan<reform_index_t, const fixed_point_t> lhs_reforms,
-	TypedSpan<reform_index_t, const fixed_point_t> rhs_reforms
+template<typename KeyType>
+struct pop_sort_entries_t final : MenuSingleton::population_menu_t::pop_sort_entries_base_t {
+	struct entry_t {
+		KeyType key;
+		/* The pop's position when the entries were made, so equal keys keep their existing order. */
+		uint32_t index;
+		std::reference_wrapper<const Pop> pop;
+	};
+
+	std::vector<entry_t> entries;
+};
+
+/* Sorts pops by a key computed once per pop (decorate-sort-undecorate), so comparisons are a direct key comparison rather
+ * than an indirect call repeating the key's lookups. Only pops from sorted_begin onwards are considered, as those before it
+ * are already in their final order, and only those up to sorted_end are guaranteed to be put in their final order, using a
+ * partial sort. The decorated pops are kept in stored_entries, so sorting further along the same list later extends the
+ * partial sort rather than computing every remaining key again; they're rebuilt if they don't match the sort key, direction
+ * or list. Equal keys are ordered by their position when decorated, and pops already in order (e.g. when a daily refresh
+ * hasn't changed any pop's key enough to reorder them) are left untouched. Returns how many pops at the front of the list
+ * are now in their final order. */
+template<typename GetKey>
+static size_t sort_pops_by_key(
+	std::vector<std::reference_wrapper<const Pop>>& pops,
+	memory::unique_ptr<MenuSingleton::population_menu_t::pop_sort_entries_base_t>& stored_entries,
+	MenuSingleton::PopSortKey sort_key, bool ascending, size_t sorted_begin, size_t sorted_end, GetKey get_key
 ) {
-	assert(lhs_party_policies.size() == rhs_party_policies.size());
-	assert(lhs_reforms.size() == rhs_reforms.size());
-
-	size_t index_of_lhs_max = 0, index_of_rhs_max = 0;
-	fixed_point_t lhs_max = fixed_point_t::usable_min, rhs_max = fixed_point_t::usable_min;
-	for (party_policy_index_t i {}; i < lhs_party_policies.size(); ++i) {
-		const fixed_point_t lhs_v = lhs_party_policies[i];
-		if (lhs_v > lhs_max) {
-			index_of_lhs_max = type_safe::get(i);
-			lhs_max = lhs_v;
-		}
-		const fixed_point_t rhs_v = rhs_party_policies[i];
-		if (rhs_v > rhs_max) {
-			index_of_rhs_max = type_safe::get(i);
-			rhs_max = rhs_v;
+	using key_t = std::invoke_result_t<GetKey, Pop const&>;
+	using entries_t = pop_sort_entries_t<key_t>;
+	using entry_t = typename entries_t::entry_t;
+
+	/* Each sort key always has the same key type, so matching sort keys means matching entry types. */
+	if (
+		stored_entries == nullptr || stored_entries->sort_key != sort_key || stored_entries->ascending != ascending
+		|| stored_entries->begin > sorted_begin
+		|| stored_entries->begin + static_cast<entries_t const*>(stored_entries.get())->entries.size() != pops.size()
+	) {
+		memory::unique_ptr<entries_t> new_entries = memory::make_unique<entries_t>();
+		new_entries->sort_key = sort_key;
+		new_entries->ascending = ascending;
+		new_entries->begin = sorted_begin;
+
+		new_entries->entries.reserve(pops.size() - sorted_begin);
+		for (size_t index = sorted_begin; index < pops.size(); ++index) {
+			new_entries->entries.push_back({ get_key(pops[index].get()), static_cast<uint32_t>(index), pops[index] });
 		}
+
+		stored_entries = std::move(new_entries);
 	}
 
-	const size_t offset = type_safe::get(lhs_party_policies.size());
-	for (reform_index_t i {}; i < lhs_reforms.size(); ++i) {
-		const fixed_point_t lhs_v = lhs_reforms[i];
-		if (lhs_v > lhs_max) {
-			index_of_lhs_max = type_safe::get(i) + offset;
-			lhs_max = lhs_v;
+	entries_t& stored = *static_cast<entries_t*>(stored_entries.get());
+	const typename std::vector<entry_t>::iterator first = stored.entries.begin() + (sorted_begin - stored.begin);
+
+	const bool partial = sorted_end - stored.begin < stored.entries.size();
+	const typename std::vector<entry_t>::iterator middle =
+		partial ? stored.entries.begin() + (sorted_end - stored.begin) : stored.entries.end();
+
+	bool reordered = false;
+	const size_t sorted_count = partial ? sorted_end : pops.size();
+
+	const auto sort_entries = [&stored, first, middle, partial, &reordered](auto const& less_than) -> void {
+		/* The pops up to sorted_end are already in their final order if they're sorted and no later pop sorts before the
+		 * last of them, which is the usual case when refreshing a list left in its previous sorted order. */
+		const auto before_last_sorted = [&less_than, middle](entry_t const& entry) -> bool {
+			return less_than(entry, *(middle - 1));
+		};
+		if (
+			std::is_sorted(first, middle, less_than)
+			&& (!partial || first == middle || std::none_of(middle, stored.entries.end(), before_last_sorted))
+		) {
+			return;
 		}
-		const fixed_point_t rhs_v = rhs_reforms[i];
-		if (rhs_v > rhs_max) {
-			index_of_rhs_max = type_safe::get(i) + offset;
-			rhs_max = rhs_v;
+		reordered = true;
+
+		if (partial) {
+			std::partial_sort(first, middle, stored.entries.end(), less_than);
+		} else {
+			std::sort(first, stored.entries.end(), less_than);
+		}
+	};
+
+	if (ascending) {
+		sort_entries([](entry_t const& lhs, entry_t const& rhs) -> bool {
+			return lhs.key < rhs.key || (!(rhs.key < lhs.key) && lhs.index < rhs.index);
+		});
+	} else {
+		sort_entries([](entry_t const& lhs, entry_t const& rhs) -> bool {
+			return rhs.key < lhs.key || (!(lhs.key < rhs.key) && lhs.index < rhs.index);
+		});
+	}
+
+	if (reordered) {
+		size_t index = sorted_begin;
+		for (typename std::vector<entry_t>::const_iterator it = first; it != stored.entries.end(); ++it) {
+			pops[index++] = it->pop;
 		}
 	}
 
-	return index_of_lhs_max > index_of_rhs_max || rhs_max > lhs_max;
+	/* Once every pop is in its final order there's nothing left to extend. */
+	if (sorted_count == pops.size()) {
+		stored_entries.reset();
+	}
+
+	return sorted_count;
 }
 
-MenuSingleton::sort_func_t MenuSingleton::_get_population_menu_sort_func(PopSortKey sort_key) const {
-	switch (sort_key) {
-	case SORT_SIZE:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_size() < b.get_size();
-		};
-	case SORT_TYPE:
-		return [this](Pop const& a, Pop const& b) -> bool {
-			return indexed_map_lookup_less_than(population_menu.pop_type_sort_cache, a.get_type(), b.get_type());
-		};
-	case SORT_CULTURE:
-		return [this](Pop const& a, Pop const& b) -> bool {
-			return ordered_map_lookup_less_than(population_menu.culture_sort_cache, a.culture, b.culture);
-		};
-	case SORT_RELIGION:
-		return [this](Pop const& a, Pop const& b) -> bool {
-			return ordered_map_lookup_less_than(population_menu.religion_sort_cache, a.religion, b.religion);
-		};
-	case SORT_LOCATION:
-		return [this](Pop const& a, Pop const& b) -> bool {
-			return indexed_map_lookup_less_than(population_menu.province_sort_cache, a.get_location(), b.get_location());
-		};
-	case SORT_MILITANCY:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_militancy() < b.get_militancy();
-		};
-	case SORT_CONSCIOUSNESS:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_consciousness() < b.get_consciousness();
-		};
-	case SORT_IDEOLOGY:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return sort_by_ideologies_less_than(
-				a.get_supporter_equivalents_by_ideology(), b.get_supporter_equivalents_by_ideology()
-			);
-		};
-	case SORT_ISSUES:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return sort_by_issues_less_than(
-				a.get_supporter_equivalents_by_party_policy(), b.get_supporter_equivalents_by_party_policy(),
-				a.get_supporter_equivalents_by_reform(), b.get_supporter_equivalents_by_reform()
+/* Pops are sorted lazily, at least this many rows at a time, as rows are requested rather than all at once. */
+static constexpr size_t POPULATION_MENU_SORT_CHUNK_ROWS = 256;
+
+Error MenuSingleton::_population_menu_order_pops() {
+	population_menu.sorted_pop_count = population_menu.sort_key != SORT_NONE ? 0 : population_menu.filtered_pops.size();
+	population_menu.pop_sort_entries.reset();
+
+	return _population_menu_sort_pops_up_to(
+		std::min(population_menu.filtered_pops.size(), POPULATION_MENU_SORT_CHUNK_ROWS)
+	);
+}
+
+Error MenuSingleton::_population_menu_sort_pops_up_to(size_t sorted_end) {
+	if (population_menu.sorted_pop_count < sorted_end) {
+		if (population_menu.sort_cache_locale.is_empty()) {
+			ERR_FAIL_COND_V(population_menu_update_locale_sort_cache() != OK, FAILED);
+		}
+
+		/* The menu's descending order lists pops with ascending keys. */
+		const bool ascending = population_menu.sort_descending;
+
+		const auto sort_by = [this, ascending, sorted_end](auto get_key) -> void {
+			population_menu.sorted_pop_count = sort_pops_by_key(
+				population_menu.filtered_pops, population_menu.pop_sort_entries, population_menu.sort_key, ascending,
+				population_menu.sorted_pop_count, sorted_end, get_key
 			);
 		};
-	case SORT_UNEMPLOYMENT:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_unemployment_fraction() < b.get_unemployment_fraction();
-		};
-	case SORT_CASH:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_cash().get_copy_of_value() < b.get_cash().get_copy_of_value();
-		};
-	case SORT_LIFE_NEEDS:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_life_needs_fulfilled() < b.get_life_needs_fulfilled();
-		};
-	case SORT_EVERYDAY_NEEDS:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_everyday_needs_fulfilled() < b.get_everyday_needs_fulfilled();
-		};
-	case SORT_LUXURY_NEEDS:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_luxury_needs_fulfilled() < b.get_luxury_needs_fulfilled();
-		};
-	case SORT_REBEL_FACTION:
-		return [this](Pop const& a, Pop const& b) -> bool {
+
+		switch (population_menu.sort_key) {
+		case SORT_SIZE:
+			sort_by([](Pop const& pop) -> pop_size_t {
+				return pop.get_size();
+			});
+			break;
+		case SORT_TYPE:
+			sort_by([this](Pop const& pop) -> size_t {
+				return population_menu.pop_type_sort_cache.at(pop.get_type());
+			});
+			break;
+		case SORT_CULTURE:
+			sort_by([this](Pop const& pop) -> size_t {
+				return population_menu.culture_sort_cache.at(&pop.culture);
+			});
+			break;
+		case SORT_RELIGION:
+			sort_by([this](Pop const& pop) -> size_t {
+				return population_menu.religion_sort_cache.at(&pop.religion);
+			});
+			break;
+		case SORT_LOCATION:
+			sort_by([this](Pop const& pop) -> size_t {
+				return population_menu.province_sort_cache.at(pop.get_location());
+			});
+			break;
+		case SORT_MILITANCY:
+			sort_by([](Pop const& pop) {
+				return pop.get_militancy();
+			});
+			break;
+		case SORT_CONSCIOUSNESS:
+			sort_by([](Pop const& pop) {
+				return pop.get_consciousness();
+			});
+			break;
+		case SORT_IDEOLOGY:
+			sort_by([](Pop const& pop) -> std::pair<int64_t, fixed_point_t> {
+				return make_max_support_sort_key(pop.get_supporter_equivalents_by_ideology());
+			});
+			break;
+		case SORT_ISSUES:
+			sort_by([](Pop const& pop) -> std::pair<int64_t, fixed_point_t> {
+				return make_max_support_sort_key(
+					pop.get_supporter_equivalents_by_party_policy(), pop.get_supporter_equivalents_by_reform()
+				);
+			});
+			break;
+		case SORT_UNEMPLOYMENT:
+			sort_by([](Pop const& pop) {
+				return pop.get_unemployment_fraction();
+			});
+			break;
+		case SORT_CASH:
+			sort_by([](Pop const& pop) {
+				return pop.get_cash().get_copy_of_value();
+			});
+			break;
+		case SORT_LIFE_NEEDS:
+			sort_by([](Pop const& pop) {
+				return pop.get_life_needs_fulfilled();
+			});
+			break;
+		case SORT_EVERYDAY_NEEDS:
+			sort_by([](Pop const& pop) {
+				return pop.get_everyday_needs_fulfilled();
+			});
+			break;
+		case SORT_LUXURY_NEEDS:
+			sort_by([](Pop const& pop) {
+				return pop.get_luxury_needs_fulfilled();
+			});
+			break;
+		case SORT_REBEL_FACTION:
 			// TODO - include country adjective for [pan-]nationalist rebels
 			// TODO - handle social/political reform movements
-			return indexed_map_lookup_less_than(
-				population_menu.rebel_type_sort_cache, a.get_rebel_type(), b.get_rebel_type()
-			);
-		};
-	case SORT_SIZE_CHANGE:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_total_change() < b.get_total_change();
-		};
-	case SORT_LITERACY:
-		return [](Pop const& a, Pop const& b) -> bool {
-			return a.get_literacy() < b.get_literacy();
-		};
-	default:
-		UtilityFunctions::push_error("Invalid population menu sort key: ", sort_key);
-		return [](Pop const& a, Pop const& b) -> bool { return false; };
+			sort_by([this](Pop const& pop) -> int64_t {
+				/* Pops without a rebel type sort before all rebel types. */
+				RebelType const* rebel_type = pop.get_rebel_type();
+				return rebel_type != nullptr ? static_cast<int64_t>(population_menu.rebel_type_sort_cache.at(*rebel_type)) : -1;
+			});
+			break;
+		case SORT_SIZE_CHANGE:
+			sort_by([](Pop const& pop) {
+				return pop.get_total_change();
+			});
+			break;
+		case SORT_LITERACY:
+			sort_by([](Pop const& pop) {
+				return pop.get_literacy();
+			});
+			break;
+		default:
+			UtilityFunctions::push_error("Invalid population menu sort key: ", population_menu.sort_key);
+			population_menu.sorted_pop_count = population_menu.filtered_pops.size();
+			break;
+		}
 	}
+
+	return OK;
 }
 
 Error MenuSingleton::_population_menu_sort_pops() {
-	if (population_menu.sort_key != SORT_NONE) {
-		if (
-			population_menu.pop_type_sort_cache.get_keys().empty()
-			|| population_menu.culture_sort_cache.empty()
-			|| population_menu.religion_sort_cache.empty()
-			|| population_menu.province_sort_cache.get_keys().empty()
-			|| population_menu.rebel_type_sort_cache.get_keys().empty()
-		) {
-			ERR_FAIL_COND_V(population_menu_update_locale_sort_cache() != OK, FAILED);
-		}
+	ERR_FAIL_COND_V(_population_menu_order_pops() != OK, FAILED);
 
-		const sort_func_t base_sort_func = _get_population_menu_sort_func(population_menu.sort_key);
+	emit_signal(_signal_population_menu_pops_changed());
 
-		const sort_func_t sort_func = population_menu.sort_descending
-			? base_sort_func
-			: [base_sort_func](Pop const& a, Pop const& b) { return base_sort_func(b, a); };
+	return OK;
+}
+
+/* Brings the menu up to date with the gamestate. Pops are only collected and filtered again if the selected provinces' pops
+ * or the filtered set have changed; otherwise filtered_pops keeps its previous sorted order, so re-sorting it by the pops'
+ * new keys leaves it untouched unless their order has actually changed. Distributions are always recalculated, as pops'
+ * values change every tick. */
+Error MenuSingleton::population_menu_refresh() {
+	Time const* time = Time::get_singleton();
+	ERR_FAIL_NULL_V(time, FAILED);
 
-		std::sort(population_menu.filtered_pops.begin(), population_menu.filtered_pops.end(), sort_func);
+	population_menu_t::refresh_timings_t& timings = population_menu.refresh_timings;
+	uint64_t step_start = time->get_ticks_usec();
+
+	if (_population_menu_pops_changed()) {
+		_population_menu_collect_pops();
+		timings.pops_collected = true;
+	} else {
+		_population_menu_update_pop_filter_counts();
+		timings.pops_collected = _population_menu_filtered_pops_changed();
 	}
+	if (timings.pops_collected) {
+		_population_menu_filter_pops();
+	}
+
+	uint64_t step_end = time->get_ticks_usec();
+	timings.pops_usec = step_end - step_start;
+	step_start = step_end;
+
+	ERR_FAIL_COND_V(_population_menu_update_distributions() != OK, FAILED);
+
+	step_end = time->get_ticks_usec();
+	timings.distributions_usec = step_end - step_start;
+	step_start = step_end;
+
+	ERR_FAIL_COND_V(_population_menu_order_pops() != OK, FAILED);
+
+	timings.sort_usec = time->get_ticks_usec() - step_start;
 
 	emit_signal(_signal_population_menu_pops_changed());
 
 	return OK;
 }
 
+Dictionary MenuSingleton::get_population_menu_refresh_timings() const {
+	static const StringName pops_usec_key = "pops_usec";
+	static const StringName distributions_usec_key = "distributions_usec";
+	static const StringName sort_usec_key = "sort_usec";
+	static const StringName pops_collected_key = "pops_collected";
+
+	Dictionary ret;
+
+	ret[pops_usec_key] = static_cast<int64_t>(population_menu.refresh_timings.pops_usec);
+	ret[distributions_usec_key] = static_cast<int64_t>(population_menu.refresh_timings.distributions_usec);
+	ret[sort_usec_key] = static_cast<int64_t>(population_menu.refresh_timings.sort_usec);
+	ret[pops_collected_key] = population_menu.refresh_timings.pops_collected;
+
+	return ret;
+}
+
+/* Rank items by their localised names. Each name's collation key (lower case, without diacritics, as UTF-32) is built
+ * once and compared natively, rather than comparing Strings through the engine for every comparison. */
+template<has_get_identifier T>
+static std::vector<size_t> make_locale_sort_ranks(Object const& translation_object, std::span<const T> items) {
+	Ref<TextServer> text_server;
+	TextServerManager* text_server_manager = TextServerManager::get_singleton();
+	if (text_server_manager != nullptr) {
+		text_server = text_server_manager->get_primary_interface();
+	}
+
+	std::vector<std::pair<std::u32string, size_t>> collation_keys;
+	collation_keys.reserve(items.size());
+
+	for (size_t idx = 0; idx < items.size(); ++idx) {
+		String identifier = convert_to<String>(items[idx].get_identifier());
+		if constexpr (std::is_same_v<T, ProvinceInstance>) {
+			identifier = GUINode::format_province_name(identifier);
+		}
+		String name = translation_object.tr(identifier);
+		if (text_server.is_valid()) {
+			name = text_server->strip_diacritics(name);
+		}
+		name = name.to_lower();
+		collation_keys.emplace_back(std::u32string { name.ptr(), static_cast<size_t>(name.length()) }, idx);
+	}
+
+	/* Ties are broken by position, so items with the same name keep their list order. */
+	std::sort(collation_keys.begin(), collation_keys.end());
+
+	std::vector<size_t> ranks(items.size());
+	for (size_t rank = 0; rank < collation_keys.size(); ++rank) {
+		ranks[collation_keys[rank].second] = rank;
+	}
+	return ranks;
+}
+
 Error MenuSingleton::population_menu_update_locale_sort_cache() {
 	GameSingleton const* game_singleton = GameSingleton::get_singleton();
 	ERR_FAIL_NULL_V(game_singleton, FAILED);
 	InstanceManager const* instance_manager = game_singleton->get_instance_manager();
 	ERR_FAIL_NULL_V(instance_manager, FAILED);
+	TranslationServer const* translation_server = TranslationServer::get_singleton();
+	ERR_FAIL_NULL_V(translation_server, FAILED);
 
-	std::vector<String> localised_items;
-	std::vector<size_t> sorted_items;
+	const StringName locale = translation_server->get_locale();
+	if (locale == population_menu.sort_cache_locale) {
+		return OK;
+	}
 
-	const auto generate_sort_cache_indexed = [this, &localised_items, &sorted_items]<has_get_identifier T>(
-		IndexedFlatMap<T, size_t>& cache, std::span<const T> items
-	) {
-		localised_items.resize(items.size());
-		sorted_items.resize(items.size());
+	const std::span<const PopType> pop_types = game_singleton->get_definition_manager().get_pop_manager().get_pop_types();
+	const std::span<const Culture> cultures = population_menu_cultures();
+	const std::span<const Religion> religions = population_menu_religions();
+	const std::span<const ProvinceInstance> provinces = instance_manager->get_map_instance().get_province_instances();
+	const std::span<const RebelType> rebel_types =
+		game_singleton->get_definition_manager().get_politics_manager().get_rebel_manager().get_rebel_types();
+
+	const auto ranks_match_items = [&](population_menu_t::locale_sort_ranks_t const& ranks) -> bool {
+		return ranks.pop_types.size() == pop_types.size() && ranks.cultures.size() == cultures.size()
+			&& ranks.religions.size() == religions.size() && ranks.provinces.size() == provinces.size()
+			&& ranks.rebel_types.size() == rebel_types.size();
+	};
 
-		for (size_t idx = 0; idx < items.size(); ++idx) {
-			String identifier = convert_to<String>(items[idx].get_identifier());
-			if constexpr (std::is_same_v<T, ProvinceInstance>) {
-				identifier = GUINode::format_province_name(identifier);
-			}
-			localised_items[idx] = tr(identifier).to_lower();
-			sorted_items[idx] = idx;
-		}
+	population_menu_t::locale_sort_ranks_t const* ranks = population_menu.locale_sort_ranks.getptr(locale);
 
-		std::sort(
-			sorted_items.begin(), sorted_items.end(), [&localised_items](size_t a, size_t b) -> bool {
-				return localised_items[a] < localised_items[b];
-			}
-		);
+	/* Ranks outlive the session they were computed in, so are dropped and recomputed if the lists have changed since. */
+	if (ranks != nullptr && !ranks_match_items(*ranks)) {
+		population_menu.locale_sort_ranks.erase(locale);
+		ranks = nullptr;
+	}
 
+	if (ranks == nullptr) {
+		ranks = &population_menu.locale_sort_ranks.insert(locale, {
+			make_locale_sort_ranks(*this, pop_types),
+			make_locale_sort_ranks(*this, cultures),
+			make_locale_sort_ranks(*this, religions),
+			make_locale_sort_ranks(*this, provinces),
+			make_locale_sort_ranks(*this, rebel_types)
+		})->value;
+	}
+
+	ERR_FAIL_COND_V_MSG(
+		!ranks_match_items(*ranks), FAILED,
+		Utilities::format("Population menu sort ranks for locale %s don't match the sorted lists", locale)
+	);
+
+	const auto fill_sort_cache_indexed = []<has_get_identifier T>(
+		IndexedFlatMap<T, size_t>& cache, std::span<const T> items, std::vector<size_t> const& item_ranks
+	) {
 		IndexedFlatMap<T, size_t> sorted_cache { items };
-		for (size_t idx = 0; idx < sorted_items.size(); ++idx) {
-			sorted_cache.at_index(
-				static_cast<typename get_index_t<T>::type>(
-					sorted_items[idx]
-				)
-			) = idx;
+		for (size_t idx = 0; idx < items.size(); ++idx) {
+			sorted_cache.at_index(static_cast<typename get_index_t<T>::type>(idx)) = item_ranks[idx];
 		}
 		cache = std::move(sorted_cache);
 	};
-	const auto generate_sort_cache_ordered = [this, &localised_items, &sorted_items]<has_get_identifier T>(
-		ordered_map<T const*, size_t>& cache, std::span<const T> items
+	const auto fill_sort_cache_ordered = []<has_get_identifier T>(
+		ordered_map<T const*, size_t>& cache, std::span<const T> items, std::vector<size_t> const& item_ranks
 	) {
-		localised_items.resize(items.size());
-		sorted_items.resize(items.size());
-
-		for (size_t idx = 0; idx < items.size(); ++idx) {
-			String identifier = convert_to<String>(items[idx].get_identifier());
-			if constexpr (std::is_same_v<T, ProvinceInstance>) {
-				identifier = GUINode::format_province_name(identifier);
-			}
-			localised_items[idx] = tr(identifier).to_lower();
-			sorted_items[idx] = idx;
-		}
-
-		std::sort(
-			sorted_items.begin(), sorted_items.end(), [&localised_items](size_t a, size_t b) -> bool {
-				return localised_items[a] < localised_items[b];
-			}
-		);
-
 		cache.clear();
-		for (size_t i = 0; i < sorted_items.size(); ++i) {
-			T const* key = &items[sorted_items[i]];
-			cache[key] = i;
+		for (size_t idx = 0; idx < items.size(); ++idx) {
+			cache[&items[idx]] = item_ranks[idx];
 		}
 	};
 
-	generate_sort_cache_indexed(
-		population_menu.pop_type_sort_cache,
-		{ game_singleton->get_definition_manager().get_pop_manager().get_pop_types() }
-	);
-	generate_sort_cache_ordered(
-		population_menu.culture_sort_cache,
-		{ game_singleton->get_definition_manager().get_pop_manager().get_culture_manager().get_cultures() }
-	);
-	generate_sort_cache_ordered(
-		population_menu.religion_sort_cache,
-		{ game_singleton->get_definition_manager().get_pop_manager().get_religion_manager().get_religions() }
-	);
-	generate_sort_cache_indexed(
-		population_menu.province_sort_cache,
-		{ instance_manager->get_map_instance().get_province_instances() }
-	);
-	generate_sort_cache_indexed(
-		population_menu.rebel_type_sort_cache,
-		{ game_singleton->get_definition_manager().get_politics_manager().get_rebel_manager().get_rebel_types() }
-	);
+	fill_sort_cache_indexed(population_menu.pop_type_sort_cache, pop_types, ranks->pop_types);
+	fill_sort_cache_ordered(population_menu.culture_sort_cache, cultures, ranks->cultures);
+	fill_sort_cache_ordered(population_menu.religion_sort_cache, religions, ranks->religions);
+	fill_sort_cache_indexed(population_menu.province_sort_cache, provinces, ranks->provinces);
+	fill_sort_cache_indexed(population_menu.rebel_type_sort_cache, rebel_types, ranks->rebel_types);
+
+	population_menu.sort_cache_locale = locale;
 
 	return OK;
 }
@@ -849,19 +1252,34 @@ GFXPieChartTexture::godot_pie_chart_data_t MenuSingleton::generate_population_me
 	);
 }
 
-TypedArray<Dictionary> MenuSingleton::get_population_menu_pop_rows(int32_t start, int32_t count) const {
-	if (population_menu.filtered_pops.empty()) {
-		return {};
-	}
+/* Clamp count to the filtered pops from start onwards and make sure those pops are in their final sorted order. */
+Error MenuSingleton::_population_menu_prepare_pop_rows(int32_t start, int32_t& count) {
 	ERR_FAIL_INDEX_V_MSG(
-		start, population_menu.filtered_pops.size(), {}, Utilities::format("Invalid start for population menu pop rows: %d", start)
+		start, population_menu.filtered_pops.size(), FAILED,
+		Utilities::format("Invalid start for population menu pop rows: %d", start)
 	);
-	ERR_FAIL_COND_V_MSG(count <= 0, {}, Utilities::format("Invalid count for population menu pop rows: %d", count));
+	ERR_FAIL_COND_V_MSG(count <= 0, FAILED, Utilities::format("Invalid count for population menu pop rows: %d", count));
 
 	if (start + count > population_menu.filtered_pops.size()) {
 		count = population_menu.filtered_pops.size() - start;
 	}
 
+	if (start + count > population_menu.sorted_pop_count) {
+		return _population_menu_sort_pops_up_to(std::min(
+			population_menu.filtered_pops.size(),
+			std::max<size_t>(start + count, population_menu.sorted_pop_count + POPULATION_MENU_SORT_CHUNK_ROWS)
+		));
+	}
+
+	return OK;
+}
+
+TypedArray<Dictionary> MenuSingleton::get_population_menu_pop_rows(int32_t start, int32_t count) {
+	if (population_menu.filtered_pops.empty()) {
+		return {};
+	}
+	ERR_FAIL_COND_V(_population_menu_prepare_pop_rows(start, count) != OK, {});
+
 	static const StringName pop_size_key = "size";
 
 	static const StringName pop_type_icon_key = "pop_type_icon";
@@ -924,14 +1342,15 @@ TypedArray<Dictionary> MenuSingleton::get_population_menu_pop_rows(int32_t start
 		{
 			party_policy_index_t party_policy_index {};
 			for(const fixed_point_t party_policy_support : pop.get_supporter_equivalents_by_party_policy()) {
-				supporter_equivalents_by_issue[&GameSingleton::get_singleton()->get_party_policy(party_policy_index)];
+				supporter_equivalents_by_issue[&GameSingleton::get_singleton()->get_party_policy(party_policy_index)] +=
+					party_policy_support;
 				++party_policy_index;
 			}
 		}
 		{
 			reform_index_t reform_index {};
 			for(const fixed_point_t reform_support : pop.get_supporter_equivalents_by_reform()) {
-				supporter_equivalents_by_issue[&GameSingleton::get_singleton()->get_reform(reform_index)];
+				supporter_equivalents_by_issue[&GameSingleton::get_singleton()->get_reform(reform_index)] += reform_support;
 				++reform_index;
 			}
 		}
@@ -969,6 +1388,166 @@ TypedArray<Dictionary> MenuSingleton::get_population_menu_pop_rows(int32_t start
 	return array;
 }
 
+/* Packed pie chart slices for a range of pops, see get_population_menu_pop_columns. */
+struct population_menu_slice_columns_t {
+	/* The identifier and colour of every possible slice, converted once rather than once per pop. */
+	std::vector<String> key_identifiers;
+	std::vector<Color> key_colours;
+
+	PackedInt32Array offsets;
+	PackedStringArray identifiers;
+	PackedColorArray colours;
+	PackedFloat32Array weights;
+
+	template<typename KeyType>
+	void add_key(KeyType const& key, String const& identifier_suffix = {}) {
+		key_identifiers.push_back(convert_to<String>(key.get_identifier()) + identifier_suffix);
+		key_colours.push_back(convert_to<Color>(key.get_colour()));
+	}
+
+	void add_slices(std::span<const fixed_point_t> values, size_t first_key_index = 0) {
+		for (size_t index = 0; index < values.size(); ++index) {
+			if (values[index] > 0) {
+				identifiers.push_back(key_identifiers[first_key_index + index]);
+				colours.push_back(key_colours[first_key_index + index]);
+				weights.push_back(static_cast<float>(values[index]));
+			}
+		}
+	}
+};
+
+Dictionary MenuSingleton::get_population_menu_pop_columns(int32_t start, int32_t count) {
+	GameSingleton* game_singleton = GameSingleton::get_singleton();
+	ERR_FAIL_NULL_V(game_singleton, {});
+
+	if (population_menu.filtered_pops.empty()) {
+		return {};
+	}
+	ERR_FAIL_COND_V(_population_menu_prepare_pop_rows(start, count) != OK, {});
+
+	static const StringName pop_size_key = "size";
+	static const StringName pop_type_icon_key = "pop_type_icon";
+	static const StringName pop_culture_key = "culture";
+	static const StringName pop_religion_icon_key = "religion_icon";
+	static const StringName pop_location_key = "location";
+	static const StringName pop_militancy_key = "militancy";
+	static const StringName pop_consciousness_key = "consciousness";
+	static const StringName pop_unemployment_key = "unemployment";
+	static const StringName pop_cash_key = "cash";
+	static const StringName pop_daily_money_key = "daily_money";
+	static const StringName pop_life_needs_key = "life_needs";
+	static const StringName pop_everyday_needs_key = "everyday_needs";
+	static const StringName pop_luxury_needs_key = "luxury_needs";
+	static const StringName pop_rebel_icon_key = "rebel_icon";
+	static const StringName pop_size_change_key = "size_change";
+	static const StringName pop_literacy_key = "literacy";
+
+	/* Each pie chart's slices are stored for all pops in shared arrays, with the slices of the pop at index i running
+	 * from offsets[i] up to offsets[i + 1]. */
+	static const StringName pop_ideology_slice_offsets_key = "ideology_slice_offsets";
+	static const StringName pop_ideology_slice_identifiers_key = "ideology_slice_identifiers";
+	static const StringName pop_ideology_slice_colours_key = "ideology_slice_colours";
+	static const StringName pop_ideology_slice_weights_key = "ideology_slice_weights";
+	static const StringName pop_issues_slice_offsets_key = "issues_slice_offsets";
+	static const StringName pop_issues_slice_identifiers_key = "issues_slice_identifiers";
+	static const StringName pop_issues_slice_colours_key = "issues_slice_colours";
+	static const StringName pop_issues_slice_weights_key = "issues_slice_weights";
+
+	population_menu_slice_columns_t ideology_columns, issues_columns;
+	for (Ideology const& ideology : game_singleton->get_ideologies()) {
+		ideology_columns.add_key(ideology);
+	}
+	/* Issues are indexed with party policies first, followed by reforms. */
+	for (PartyPolicy const& party_policy : game_singleton->get_party_policies()) {
+		issues_columns.add_key(party_policy, get_issue_identifier_suffix());
+	}
+	const size_t first_reform_index = issues_columns.key_identifiers.size();
+	for (Reform const& reform : game_singleton->get_reforms()) {
+		issues_columns.add_key(reform, get_issue_identifier_suffix());
+	}
+
+	PackedInt32Array sizes, pop_type_icons, religion_icons, rebel_icons, size_changes;
+	PackedStringArray cultures, locations;
+	PackedFloat32Array militancies, consciousnesses, unemployments, cash, daily_money, life_needs, everyday_needs,
+		luxury_needs, literacies;
+
+	for (PackedInt32Array* column : { &sizes, &pop_type_icons, &religion_icons, &rebel_icons, &size_changes }) {
+		ERR_FAIL_COND_V(column->resize(count) != OK, {});
+	}
+	for (PackedStringArray* column : { &cultures, &locations }) {
+		ERR_FAIL_COND_V(column->resize(count) != OK, {});
+	}
+	for (PackedFloat32Array* column : {
+		&militancies, &consciousnesses, &unemployments, &cash, &daily_money, &life_needs, &everyday_needs, &luxury_needs,
+		&literacies
+	}) {
+		ERR_FAIL_COND_V(column->resize(count) != OK, {});
+	}
+	for (population_menu_slice_columns_t* slice_columns : { &ideology_columns, &issues_columns }) {
+		ERR_FAIL_COND_V(slice_columns->offsets.resize(count + 1) != OK, {});
+	}
+
+	for (int32_t idx = 0; idx < count; ++idx) {
+		Pop const& pop = population_menu.filtered_pops[start + idx];
+
+		sizes[idx] = type_safe::get(pop.get_size());
+		pop_type_icons[idx] = pop.get_type().sprite;
+		cultures[idx] = convert_to<String>(pop.culture.get_identifier());
+		religion_icons[idx] = pop.religion.icon;
+		locations[idx] = convert_to<String>(pop.get_location().get_identifier());
+		militancies[idx] = static_cast<float>(pop.get_militancy());
+		consciousnesses[idx] = static_cast<float>(pop.get_consciousness());
+		unemployments[idx] = static_cast<float>(pop.get_unemployment_fraction());
+		cash[idx] = static_cast<float>(pop.get_cash().get_copy_of_value());
+		daily_money[idx] = static_cast<float>(pop.get_income());
+		life_needs[idx] = static_cast<float>(pop.get_life_needs_fulfilled());
+		everyday_needs[idx] = static_cast<float>(pop.get_everyday_needs_fulfilled());
+		luxury_needs[idx] = static_cast<float>(pop.get_luxury_needs_fulfilled());
+		rebel_icons[idx] = pop.get_rebel_type() != nullptr ? pop.get_rebel_type()->icon : 0;
+		size_changes[idx] = type_safe::get(pop.get_total_change());
+		literacies[idx] = static_cast<float>(pop.get_literacy());
+
+		ideology_columns.offsets[idx] = ideology_columns.weights.size();
+		ideology_columns.add_slices(pop.get_supporter_equivalents_by_ideology());
+
+		issues_columns.offsets[idx] = issues_columns.weights.size();
+		issues_columns.add_slices(pop.get_supporter_equivalents_by_party_policy());
+		issues_columns.add_slices(pop.get_supporter_equivalents_by_reform(), first_reform_index);
+	}
+	ideology_columns.offsets[count] = ideology_columns.weights.size();
+	issues_columns.offsets[count] = issues_columns.weights.size();
+
+	Dictionary ret;
+
+	ret[pop_size_key] = std::move(sizes);
+	ret[pop_type_icon_key] = std::move(pop_type_icons);
+	ret[pop_culture_key] = std::move(cultures);
+	ret[pop_religion_icon_key] = std::move(religion_icons);
+	ret[pop_location_key] = std::move(locations);
+	ret[pop_militancy_key] = std::move(militancies);
+	ret[pop_consciousness_key] = std::move(consciousnesses);
+	ret[pop_unemployment_key] = std::move(unemployments);
+	ret[pop_cash_key] = std::move(cash);
+	ret[pop_daily_money_key] = std::move(daily_money);
+	ret[pop_life_needs_key] = std::move(life_needs);
+	ret[pop_everyday_needs_key] = std::move(everyday_needs);
+	ret[pop_luxury_needs_key] = std::move(luxury_needs);
+	ret[pop_rebel_icon_key] = std::move(rebel_icons);
+	ret[pop_size_change_key] = std::move(size_changes);
+	ret[pop_literacy_key] = std::move(literacies);
+
+	ret[pop_ideology_slice_offsets_key] = std::move(ideology_columns.offsets);
+	ret[pop_ideology_slice_identifiers_key] = std::move(ideology_columns.identifiers);
+	ret[pop_ideology_slice_colours_key] = std::move(ideology_columns.colours);
+	ret[pop_ideology_slice_weights_key] = std::move(ideology_columns.weights);
+	ret[pop_issues_slice_offsets_key] = std::move(issues_columns.offsets);
+	ret[pop_issues_slice_identifiers_key] = std::move(issues_columns.identifiers);
+	ret[pop_issues_slice_colours_key] = std::move(issues_columns.colours);
+	ret[pop_issues_slice_weights_key] = std::move(issues_columns.weights);
+
+	return ret;
+}
+
 int32_t MenuSingleton::get_population_menu_pop_row_count() const {
 	return population_menu.filtered_pops.size();
 }
@@ -1108,10 +1687,18 @@ TypedArray<Array> MenuSingleton::get_population_menu_distribution_info() const {
 		);
 	};
 
-	array[0] = GFXPieChartTexture::distribution_to_slices_array(population_menu.workforce_distribution, make_pie_chart_tooltip);
-	array[1] = GFXPieChartTexture::distribution_to_slices_array(population_menu.religion_distribution, make_pie_chart_tooltip);
-	array[2] = GFXPieChartTexture::distribution_to_slices_array(population_menu.ideology_distribution, make_pie_chart_tooltip);
-	array[3] = GFXPieChartTexture::distribution_to_slices_array(population_menu.culture_distribution, make_pie_chart_tooltip);
+	const auto make_slices_array = [&make_pie_chart_tooltip]<typename KeyType>(
+		population_menu_t::distribution_t<KeyType> const& distribution
+	) -> GFXPieChartTexture::godot_pie_chart_data_t {
+		return GFXPieChartTexture::distribution_to_slices_array<KeyType const*, fixed_point_t>(
+			distribution.keys, distribution.values, make_pie_chart_tooltip
+		);
+	};
+
+	array[0] = make_slices_array(population_menu.workforce_distribution);
+	array[1] = make_slices_array(population_menu.religion_distribution);
+	array[2] = make_slices_array(population_menu.ideology_distribution);
+	array[3] = make_slices_array(population_menu.culture_distribution);
 	array[4] = GFXPieChartTexture::distribution_to_slices_array(
 		population_menu.issue_distribution, make_pie_chart_tooltip, get_issue_identifier_suffix()
 	);
@@ -188,50 +188,45 @@ Dictionary MenuSingleton::get_trade_menu_trade_details_info(
 	return ret;
 }
 
-Dictionary MenuSingleton::get_trade_menu_tables_info() const {
-	static const StringName good_producers_tooltips_key = "good_producers_tooltips";
-	static const StringName good_trading_yesterday_tooltips_key = "good_trading_yesterday_tooltips";
-	static const StringName government_needs_key = "government_needs";
-	static const StringName factory_needs_key = "factory_needs";
-	static const StringName pop_needs_key = "pop_needs";
-	static const StringName market_activity_key = "market_activity";
-	static const StringName stockpile_key = "stockpile";
-	static const StringName common_market_key = "common_market";
-
+String MenuSingleton::_make_good_top_producers_tooltip(GoodInstance const& good) const {
 	InstanceManager const* instance_manager = GameSingleton::get_singleton()->get_instance_manager();
 	ERR_FAIL_NULL_V(instance_manager, {});
-	GoodInstanceManager const& good_instance_manager = instance_manager->get_good_instance_manager();
 
-	Dictionary ret;
+	static const StringName top_producers_localisation_key = "TRADE_TOP_PRODUCERS";
+
+	String tooltip = tr(convert_to<String>(good.get_identifier())) + get_tooltip_separator() +
+		tr(top_producers_localisation_key);
 
-	// This needs an entry for every good, even untradeable and unavailable ones, so we can look entries up with good indices
-	PackedStringArray good_producers_tooltips;
 	// TODO - replace test code with actual top producers
 	CountryInstanceManager const& country_instance_manager = instance_manager->get_country_instance_manager();
-	for (GoodInstance const& good : good_instance_manager.get_good_instances()) {
-		static const StringName top_producers_localisation_key = "TRADE_TOP_PRODUCERS";
+	for (size_t index = 0; index < 5; ++index) {
+		CountryInstance const& other_country = country_instance_manager.get_country_instance_by_index(
+			country_index_t(index + 1)
+		);
 
-		String tooltip = tr(convert_to<String>(good.get_identifier())) + get_tooltip_separator() +
-			tr(top_producers_localisation_key);
+		static const String top_producer_template_string = "\n" + GUILabel::get_flag_marker() + "%s %s: %s";
 
-		for (size_t index = 0; index < 5; ++index) {
-			CountryInstance const& other_country = country_instance_manager.get_country_instance_by_index(
-				country_index_t(index + 1)
-			);
+		tooltip += Utilities::format(
+			top_producer_template_string,
+			convert_to<String>(other_country.get_identifier()),
+			Utilities::get_country_name(*this, other_country),
+			Utilities::fixed_point_to_string_dp(fixed_point_t(1000) / static_cast<int32_t>(index + 1), 2)
+		);
+	}
 
-			static const String top_producer_template_string = "\n" + GUILabel::get_flag_marker() + "%s %s: %s";
+	return tooltip;
+}
 
-			tooltip += Utilities::format(
-				top_producer_template_string,
-				convert_to<String>(other_country.get_identifier()),
-				Utilities::get_country_name(*this, other_country),
-				Utilities::fixed_point_to_string_dp(fixed_point_t(1000) / static_cast<int32_t>(index + 1), 2)
-			);
-		}
+Dictionary MenuSingleton::get_trade_menu_tables_info() const {
+	static const StringName good_trading_yesterday_tooltips_key = "good_trading_yesterday_tooltips";
+	static const StringName government_needs_key = "government_needs";
+	static const StringName factory_needs_key = "factory_needs";
+	static const StringName pop_needs_key = "pop_needs";
+	static const StringName market_activity_key = "market_activity";
+	static const StringName stockpile_key = "stockpile";
+	static const StringName common_market_key = "common_market";
 
-		good_producers_tooltips.push_back(tooltip);
-	}
-	ret[good_producers_tooltips_key] = std::move(good_producers_tooltips);
+	Dictionary ret;
 
 	CountryInstance const* country_ptr = PlayerSingleton::get_singleton()->get_player_country();
 	if (unlikely(country_ptr == nullptr)) {
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <utility>
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+
+#include <openvic-simulation/core/memory/Vector.hpp>
+
+namespace OpenVic {
+	/* Values are either a Ref to a RefCounted resource, or a struct with a get_cache_reference method returning the
+	 * RefCounted held by everything using the value. */
+	template<typename Value>
+	concept RefCountedCacheValue = requires(Value const& value) {
+		{ value->get_reference_count() } -> std::convertible_to<int32_t>;
+	} || requires(Value const& value) {
+		{ value.get_cache_reference()->get_reference_count() } -> std::convertible_to<int32_t>;
+	};
+
+	/* A cache of values shared between every user of the same key, kept for as long as anything other than the cache
+	 * references them. Unused entries aren't found as soon as they become unused, but by pruning the whole cache each
+	 * time it grows to its prune threshold, which is then set to double the number of entries left (and never below
+	 * MIN_PRUNE_THRESHOLD), so pruning stays amortised O(1) per insertion. Keys must have a static hash function. */
+	template<typename Key, RefCountedCacheValue Value, size_t MIN_PRUNE_THRESHOLD>
+	class RefCountedCache {
+		using map_t = godot::HashMap<Key, Value, Key>;
+
+		map_t entries;
+		/* Entry count at which the cache is next pruned. */
+		size_t prune_threshold = MIN_PRUNE_THRESHOLD;
+
+		static bool _is_unused(Value const& value) {
+			/* A reference count of 1 means the only remaining reference is the one held by this cache. */
+			if constexpr (requires { value.get_cache_reference(); }) {
+				return value.get_cache_reference()->get_reference_count() <= 1;
+			} else {
+				return value->get_reference_count() <= 1;
+			}
+		}
+
+	public:
+		/* Return the value cached for the key, or nullptr if there is none. */
+		Value const* find(Key const& key) const {
+			const typename map_t::ConstIterator it = entries.find(key);
+			return it != entries.end() ? &it->value : nullptr;
+		}
+
+		/* Add or replace the value for the key, first pruning the cache if it has reached its prune threshold. on_prune is
+		 * called with every pruned value just before it's removed, e.g. to release resources it was allocated. */
+		template<typename OnPrune>
+		Value& insert(Key const& key, Value const& value, OnPrune&& on_prune) {
+			if (entries.size() >= prune_threshold) {
+				prune(on_prune);
+			}
+			return entries.insert(key, value)->value;
+		}
+
+		Value& insert(Key const& key, Value const& value) {
+			return insert(key, value, [](Value const&) -> void {});
+		}
+
+		void erase(Key const& key) {
+			entries.erase(key);
+		}
+
+		/* Remove every value which is no longer used anywhere else. */
+		template<typename OnPrune>
+		void prune(OnPrune&& on_prune) {
+			memory::vector<Key> unused_keys;
+
+			for (godot::KeyValue<Key, Value> const& key_value : entries) {
+				if (_is_unused(key_value.value)) {
+					unused_keys.push_back(key_value.key);
+				}
+			}
+
+			for (Key const& key : unused_keys) {
+				on_prune(entries[key]);
+				entries.erase(key);
+			}
+
+			prune_threshold = std::max(MIN_PRUNE_THRESHOLD, entries.size() * 2);
+		}
+
+		size_t size() const {
+			return entries.size();
+		}
+	};
+}
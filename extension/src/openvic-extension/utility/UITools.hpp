@@ -1,6 +1,8 @@
 #pragma once
 
 #include <godot_cpp/classes/control.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+#include <godot_cpp/core/error_macros.hpp>
 
 #include <openvic-simulation/interface/GFXSprite.hpp>
 #include <openvic-simulation/interface/GUI.hpp>
@@ -16,4 +18,23 @@ namespace OpenVic::UITools {
 	bool generate_gui_element(
 		godot::String const& gui_scene, godot::String const& gui_element, godot::String const& name, godot::Control*& result
 	);
+
+	/* Enable or disable the texture's shader mode, then set the canvas item drawing it to use the texture's shared shader
+	 * material (or no material if shader mode is disabled) and, in shader mode, its per-instance shader parameters.
+	 * Nodes drawing a texture in shader mode call this again whenever the texture emits its changed signal. */
+	template<typename T>
+	godot::Error apply_texture_shader_mode(godot::CanvasItem& canvas_item, T& texture, bool shader_mode) {
+		ERR_FAIL_COND_V(texture.set_shader_mode(shader_mode) != godot::OK, godot::FAILED);
+
+		const godot::Ref<godot::ShaderMaterial> shader_material = texture.get_shader_material();
+		if (canvas_item.get_material().ptr() != shader_material.ptr()) {
+			canvas_item.set_material(shader_material);
+		}
+
+		if (shader_mode) {
+			texture.apply_shader_instance_parameters(&canvas_item);
+		}
+
+		return godot::OK;
+	}
 }
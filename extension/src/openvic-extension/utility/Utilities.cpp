@@ -1,5 +1,8 @@
 #include "Utilities.hpp"
 
+#include <bit>
+#include <cstring>
+
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
@@ -196,12 +199,59 @@ Ref<Resource> Utilities::load_resource(String const& path, String const& type_hi
 	return loader->load(path, type_hint);
 }
 
-static Ref<Image> load_dds_image(String const& path) {
+/* Swap the red and blue channels of tightly packed 32-bit pixels. Working on whole pixels with masks and shifts rather
+ * than on individual bytes lets the compiler vectorise the loop with whatever SIMD instructions the target supports. */
+static void swizzle_bgra_to_rgba(uint8_t const* src, uint8_t* dst, size_t pixel_count) {
+	static_assert(std::endian::native == std::endian::little, "BGRA swizzle assumes little endian pixel words");
+
+	for (size_t index = 0; index < pixel_count; ++index) {
+		uint32_t pixel;
+		std::memcpy(&pixel, src + index * sizeof(pixel), sizeof(pixel));
+		pixel = (pixel & 0xFF00FF00) | ((pixel >> 16) & 0x000000FF) | ((pixel << 16) & 0x00FF0000);
+		std::memcpy(dst + index * sizeof(pixel), &pixel, sizeof(pixel));
+	}
+}
+
+/* The Godot format matching a block compressed DDS format, or FORMAT_MAX if it isn't one Godot can use directly. */
+static Image::Format get_compressed_image_format(gli::format format) {
+	switch (format) {
+	case gli::FORMAT_RGB_DXT1_UNORM_BLOCK8:
+	case gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8:  return Image::FORMAT_DXT1;
+	case gli::FORMAT_RGBA_DXT3_UNORM_BLOCK16: return Image::FORMAT_DXT3;
+	case gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16: return Image::FORMAT_DXT5;
+	default:                                  return Image::FORMAT_MAX;
+	}
+}
+
+static Ref<Image> load_dds_image(String const& path, bool keep_compressed) {
 	const gli::texture dds_file = gli::load_dds(convert_to<std::string>(path));
 	ERR_FAIL_COND_V_MSG(dds_file.empty(), nullptr, Utilities::format("Failed to load DDS file: %s", path));
 	gli::texture2d texture { dds_file };
 	ERR_FAIL_COND_V_MSG(texture.empty(), nullptr, Utilities::format("Failed to create DDS texture: %s", path));
 
+	if (keep_compressed) {
+		const Image::Format compressed_format = get_compressed_image_format(texture.format());
+
+		if (compressed_format != Image::FORMAT_MAX) {
+			/* Only the base level is used, matching the uncompressed path which never generates mipmaps. */
+			const gli::texture2d::extent_type extent { texture.extent(0) };
+			const int32_t width = extent.x, height = extent.y;
+			/* DXT stores 4x4 pixel blocks, 8 bytes each for DXT1 and 16 bytes for DXT3/5. */
+			const int64_t block_size = compressed_format == Image::FORMAT_DXT1 ? 8 : 16;
+			const int64_t size = ((width + 3) / 4) * ((height + 3) / 4) * block_size;
+
+			if (static_cast<size_t>(size) <= texture.size(0)) {
+				PackedByteArray blocks;
+				ERR_FAIL_COND_V(blocks.resize(size) != OK, nullptr);
+				std::memcpy(blocks.ptrw(), texture.data(0, 0, 0), size);
+
+				return Image::create_from_data(width, height, false, compressed_format, blocks);
+			}
+
+			/* If the block data is shorter than expected, fall back to converting it like any other format. */
+		}
+	}
+
 	static constexpr gli::format expected_format = gli::FORMAT_BGRA8_UNORM_PACK8;
 	const bool needs_bgr_to_rgb = texture.format() == expected_format;
 	if (!needs_bgr_to_rgb) {
@@ -221,22 +271,21 @@ static Ref<Image> load_dds_image(String const& path) {
 	PackedByteArray pixels;
 	ERR_FAIL_COND_V(pixels.resize(size) != OK, nullptr);
 
-	/* Index offset used to control whether we are reading */
-	const size_t rb_idx = 2 * needs_bgr_to_rgb;
-	uint8_t const* ptr = static_cast<uint8_t const*>(texture.data());
-	for (size_t i = 0; i < size; i += 4) {
-		pixels[i + 0] = ptr[i + rb_idx];
-		pixels[i + 1] = ptr[i + 1];
-		pixels[i + 2] = ptr[i + 2 - rb_idx];
-		pixels[i + 3] = ptr[i + 3];
+	/* Write through the raw pointer, as PackedByteArray::operator[] does a copy-on-write check on every access. */
+	uint8_t* const dst = pixels.ptrw();
+	uint8_t const* const src = static_cast<uint8_t const*>(texture.data());
+	if (needs_bgr_to_rgb) {
+		swizzle_bgra_to_rgba(src, dst, width * height);
+	} else {
+		std::memcpy(dst, src, size);
 	}
 
 	return Image::create_from_data(width, height, false, Image::FORMAT_RGBA8, pixels);
 }
 
-Ref<Image> Utilities::load_godot_image(String const& path) {
+Ref<Image> Utilities::load_godot_image(String const& path, bool keep_compressed) {
 	if (path.ends_with(".dds")) {
-		return load_dds_image(path);
+		return load_dds_image(path, keep_compressed);
 	}
 	return Image::load_from_file(path);
 }
@@ -63,8 +63,10 @@ namespace OpenVic::Utilities {
 	godot::Ref<godot::Resource> load_resource(godot::String const& path, godot::String const& type_hint = {});
 
 	/* Load an Image from anywhere on the machine, using Godot's image-loading function or, in the case of
-	 * ".dds" image files which Godot is unable to load at runtime, GLI's DDS loading function. */
-	godot::Ref<godot::Image> load_godot_image(godot::String const& path);
+	 * ".dds" image files which Godot is unable to load at runtime, GLI's DDS loading function. If keep_compressed
+	 * is true then DXT1/3/5 ".dds" files are returned in their compressed format rather than being converted to RGBA8,
+	 * which is faster and uses less memory but means the image can't be read or modified pixel by pixel. */
+	godot::Ref<godot::Image> load_godot_image(godot::String const& path, bool keep_compressed = false);
 
 	/* Load a Font from anywhere on the machine, combining the ".fnt" file loaded from the given path with the
 	 * already-loaded image file containing the actual characters. */
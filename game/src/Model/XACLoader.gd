@@ -327,9 +327,17 @@ static func _load_xac_model(source_file: String, is_unit: bool) -> Node3D:
 	return node
 
 
-static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChunk]) -> Array[MaterialDefinition]:
+static func get_model_texture(texture_name: String) -> ImageTexture:
 	const TEXTURES_PATH: String = "gfx/anims/%s.dds"
+	# Model textures are only ever sampled on the GPU, so DXT compressed files can skip decompression.
+	const TEXTURE_LOAD_FLAGS: int = (
+		AssetManager.LOAD_FLAG_CACHE_TEXTURE | AssetManager.LOAD_FLAG_KEEP_COMPRESSED
+	)
+
+	return AssetManager.get_texture(TEXTURES_PATH % texture_name, TEXTURE_LOAD_FLAGS)
 
+
+static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChunk]) -> Array[MaterialDefinition]:
 	var materials: Array[MaterialDefinition] = []
 
 	for matdef: MaterialDefinitionChunk in materialDefinitionChunks:
@@ -390,7 +398,7 @@ static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChu
 
 			var textures_index_spec: int = added_unit_textures_spec.find(specular_name)
 			if textures_index_spec < 0:
-				var unit_colours_mask_texture: ImageTexture = AssetManager.get_texture(TEXTURES_PATH % specular_name)
+				var unit_colours_mask_texture: ImageTexture = get_model_texture(specular_name)
 				if unit_colours_mask_texture:
 					added_unit_textures_spec.push_back(specular_name)
 
@@ -409,7 +417,7 @@ static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChu
 
 			var textures_index_diffuse: int = added_unit_textures_diffuse.find(diffuse_name)
 			if textures_index_diffuse < 0:
-				var diffuse_texture: ImageTexture = AssetManager.get_texture(TEXTURES_PATH % diffuse_name)
+				var diffuse_texture: ImageTexture = get_model_texture(diffuse_name)
 				if diffuse_texture:
 					added_unit_textures_diffuse.push_back(diffuse_name)
 
@@ -433,7 +441,7 @@ static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChu
 			if specular_name:
 				push_error("Specular texture present in flag material: ", specular_name)
 
-			var flag_normal_texture: ImageTexture = AssetManager.get_texture(TEXTURES_PATH % normal_name)
+			var flag_normal_texture: ImageTexture = get_model_texture(normal_name)
 			if flag_normal_texture:
 				flag_shader.set_shader_parameter(&"texture_normal", flag_normal_texture)
 			else:
@@ -450,7 +458,7 @@ static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChu
 
 			var scroll_textures_index_diffuse: int = added_scrolling_textures_diffuse.find(diffuse_name)
 			if scroll_textures_index_diffuse < 0:
-				var diffuse_texture: ImageTexture = AssetManager.get_texture(TEXTURES_PATH % diffuse_name)
+				var diffuse_texture: ImageTexture = get_model_texture(diffuse_name)
 				if diffuse_texture:
 					added_scrolling_textures_diffuse.push_back(diffuse_name)
 
@@ -487,14 +495,14 @@ static func make_materials(materialDefinitionChunks: Array[MaterialDefinitionChu
 			mat.transparency = BaseMaterial3D.TRANSPARENCY_ALPHA_DEPTH_PRE_PASS
 
 			if diffuse_name:
-				var diffuse_texture: ImageTexture = AssetManager.get_texture(TEXTURES_PATH % diffuse_name)
+				var diffuse_texture: ImageTexture = get_model_texture(diffuse_name)
 				if diffuse_texture:
 					mat.set_texture(BaseMaterial3D.TEXTURE_ALBEDO, diffuse_texture)
 				else:
 					push_error("Failed to load diffuse texture: ", diffuse_name)
 
 			if normal_name:
-				var normal_texture: ImageTexture = AssetManager.get_texture(TEXTURES_PATH % normal_name)
+				var normal_texture: ImageTexture = get_model_texture(normal_name)
 				if normal_texture:
 					mat.normal_enabled = true
 					mat.set_texture(BaseMaterial3D.TEXTURE_NORMAL, normal_texture)
@@ -443,22 +443,22 @@ func _update_info() -> void:
 	if _active:
 		# Military stats
 		const military_info_war_exhaustion_key: StringName = &"war_exhaustion"
-		const military_info_war_exhaustion_tooltip_key: StringName = &"war_exhaustion_tooltip"
+		const military_info_war_exhaustion_tooltip_id_key: StringName = &"war_exhaustion_tooltip_id"
 		const military_info_supply_consumption_key: StringName = &"supply_consumption"
-		const military_info_supply_consumption_tooltip_key: StringName = &"supply_consumption_tooltip"
+		const military_info_supply_consumption_tooltip_id_key: StringName = &"supply_consumption_tooltip_id"
 		const military_info_organisation_regain_key: StringName = &"organisation_regain"
-		const military_info_organisation_regain_tooltip_key: StringName = &"organisation_regain_tooltip"
+		const military_info_organisation_regain_tooltip_id_key: StringName = &"organisation_regain_tooltip_id"
 		const military_info_land_organisation_key: StringName = &"land_organisation"
-		const military_info_land_organisation_tooltip_key: StringName = &"land_organisation_tooltip"
+		const military_info_land_organisation_tooltip_id_key: StringName = &"land_organisation_tooltip_id"
 		const military_info_naval_organisation_key: StringName = &"naval_organisation"
-		const military_info_naval_organisation_tooltip_key: StringName = &"naval_organisation_tooltip"
+		const military_info_naval_organisation_tooltip_id_key: StringName = &"naval_organisation_tooltip_id"
 		const military_info_land_unit_start_experience_key: StringName = &"land_unit_start_experience"
 		const military_info_naval_unit_start_experience_key: StringName = &"naval_unit_start_experience"
-		const military_info_unit_start_experience_tooltip_key: StringName = &"unit_start_experience_tooltip"
+		const military_info_unit_start_experience_tooltip_id_key: StringName = &"unit_start_experience_tooltip_id"
 		const military_info_recruit_time_key: StringName = &"recruit_time"
-		const military_info_recruit_time_tooltip_key: StringName = &"recruit_time_tooltip"
+		const military_info_recruit_time_tooltip_id_key: StringName = &"recruit_time_tooltip_id"
 		const military_info_combat_width_key: StringName = &"combat_width"
-		const military_info_combat_width_tooltip_key: StringName = &"combat_width_tooltip"
+		const military_info_combat_width_tooltip_id_key: StringName = &"combat_width_tooltip_id"
 		const military_info_dig_in_cap_key: StringName = &"dig_in_cap"
 		const military_info_military_tactics_key: StringName = &"military_tactics"
 
@@ -466,10 +466,10 @@ func _update_info() -> void:
 		const military_info_is_mobilised_key: StringName = &"is_mobilised"
 		const military_info_mobilisation_progress_key: StringName = &"mobilisation_progress"
 		const military_info_mobilisation_size_key: StringName = &"mobilisation_size"
-		const military_info_mobilisation_size_tooltip_key: StringName = &"mobilisation_size_tooltip"
-		const military_info_mobilisation_impact_tooltip_key: StringName = &"mobilisation_impact_tooltip"
+		const military_info_mobilisation_size_tooltip_id_key: StringName = &"mobilisation_size_tooltip_id"
+		const military_info_mobilise_tooltip_id_key: StringName = &"mobilise_tooltip_id"
 		const military_info_mobilisation_economy_impact_key: StringName = &"mobilisation_economy_impact"
-		const military_info_mobilisation_economy_impact_tooltip_key: StringName = &"mobilisation_economy_impact_tooltip"
+		const military_info_mobilisation_economy_impact_tooltip_id_key: StringName = &"mobilisation_economy_impact_tooltip_id"
 
 		# Leaders
 		const military_info_general_count_key: StringName = &"general_count"
@@ -492,19 +492,19 @@ func _update_info() -> void:
 		# Military stats
 		if _war_exhaustion_label:
 			_war_exhaustion_label.set_text(military_info.get(military_info_war_exhaustion_key, "0.00/0.00"))
-			_war_exhaustion_label.set_tooltip_string(military_info.get(military_info_war_exhaustion_tooltip_key, ""))
+			_war_exhaustion_label.set_tooltip_id(military_info.get(military_info_war_exhaustion_tooltip_id_key, 0))
 		if _supply_consumption_label:
 			_supply_consumption_label.set_text("%d%%" % int(100 * military_info.get(military_info_supply_consumption_key, 0)))
-			_supply_consumption_label.set_tooltip_string(military_info.get(military_info_supply_consumption_tooltip_key, ""))
+			_supply_consumption_label.set_tooltip_id(military_info.get(military_info_supply_consumption_tooltip_id_key, 0))
 		if _organisation_regain_label:
 			_organisation_regain_label.set_text("%d%%" % int(100 * military_info.get(military_info_organisation_regain_key, 0)))
-			_organisation_regain_label.set_tooltip_string(military_info.get(military_info_organisation_regain_tooltip_key, ""))
+			_organisation_regain_label.set_tooltip_id(military_info.get(military_info_organisation_regain_tooltip_id_key, 0))
 		if _land_organisation_label:
 			_land_organisation_label.set_text("%d%%" % int(100 * military_info.get(military_info_land_organisation_key, 0)))
-			_land_organisation_label.set_tooltip_string(military_info.get(military_info_land_organisation_tooltip_key, ""))
+			_land_organisation_label.set_tooltip_id(military_info.get(military_info_land_organisation_tooltip_id_key, 0))
 		if _naval_organisation_label:
 			_naval_organisation_label.set_text("%d%%" % int(100 * military_info.get(military_info_naval_organisation_key, 0)))
-			_naval_organisation_label.set_tooltip_string(military_info.get(military_info_naval_organisation_tooltip_key, ""))
+			_naval_organisation_label.set_tooltip_id(military_info.get(military_info_naval_organisation_tooltip_id_key, 0))
 		if _unit_start_experience_label:
 			_unit_start_experience_label.set_text(
 				"%s/%s" % [
@@ -518,13 +518,13 @@ func _update_info() -> void:
 					),
 				]
 			)
-			_unit_start_experience_label.set_tooltip_string(military_info.get(military_info_unit_start_experience_tooltip_key, ""))
+			_unit_start_experience_label.set_tooltip_id(military_info.get(military_info_unit_start_experience_tooltip_id_key, 0))
 		if _recruit_time_label:
 			_recruit_time_label.set_text("%d%%" % int(100 * military_info.get(military_info_recruit_time_key, 0)))
-			_recruit_time_label.set_tooltip_string(military_info.get(military_info_recruit_time_tooltip_key, ""))
+			_recruit_time_label.set_tooltip_id(military_info.get(military_info_recruit_time_tooltip_id_key, 0))
 		if _combat_width_label:
 			_combat_width_label.set_text(str(military_info.get(military_info_combat_width_key, 0)))
-			_combat_width_label.set_tooltip_string(military_info.get(military_info_combat_width_tooltip_key, ""))
+			_combat_width_label.set_tooltip_id(military_info.get(military_info_combat_width_tooltip_id_key, 0))
 		if _dig_in_cap_label:
 			_dig_in_cap_label.set_text(str(military_info.get(military_info_dig_in_cap_key, 0)))
 		if _military_tactics_label:
@@ -534,22 +534,10 @@ func _update_info() -> void:
 		var is_mobilised: bool = military_info.get(military_info_is_mobilised_key, false)
 		var mobilisation_size: int = military_info.get(military_info_mobilisation_size_key, 0)
 		var can_mobilise: bool = mobilisation_size > 0
-		var mobilisation_size_tooltip: String = military_info.get(
-			military_info_mobilisation_size_tooltip_key,
-			"",
-		)
-		var mobilisation_impact_tooltip: String = military_info.get(
-			military_info_mobilisation_impact_tooltip_key,
-			"",
-		)
 		if _mobilise_button:
 			_mobilise_button.set_visible(not is_mobilised)
 			_mobilise_button.set_disabled(not can_mobilise)
-			_mobilise_button.set_tooltip_string(
-				tr(&"MILITARY_MOBILIZE") + "\n" + mobilisation_size_tooltip +
-				("\n\n" + tr(&"NOT_ENOUGH_FOR_BRIGADE") + "\n\n" if not can_mobilise else "\n\n\n") +
-				mobilisation_impact_tooltip + MenuSingleton.get_tooltip_separator() + tr(&"MILITARY_MOBILIZE_DESC")
-			)
+			_mobilise_button.set_tooltip_id(military_info.get(military_info_mobilise_tooltip_id_key, 0))
 		if _demobilise_button:
 			_demobilise_button.set_visible(is_mobilised)
 		var mobilisation_progress: float = military_info.get(
@@ -569,12 +557,10 @@ func _update_info() -> void:
 			_mobilisation_progress_label.set_text("%s%%" % mobilisation_progress_string)
 		if _mobilisation_size_label:
 			_mobilisation_size_label.set_text(str(mobilisation_size))
-			_mobilisation_size_label.set_tooltip_string(
-				mobilisation_size_tooltip + ("" if mobilisation_impact_tooltip.is_empty() else "\n\n\n" + mobilisation_impact_tooltip)
-			)
+			_mobilisation_size_label.set_tooltip_id(military_info.get(military_info_mobilisation_size_tooltip_id_key, 0))
 		if _mobilisation_economy_impact_label:
 			_mobilisation_economy_impact_label.set_text("%s%%" % GUINode.float_to_string_dp(100 * military_info.get(military_info_mobilisation_economy_impact_key, 0), 2))
-			_mobilisation_economy_impact_label.set_tooltip_string(military_info.get(military_info_mobilisation_economy_impact_tooltip_key, ""))
+			_mobilisation_economy_impact_label.set_tooltip_id(military_info.get(military_info_mobilisation_economy_impact_tooltip_id_key, 0))
 
 		# Leaders
 		if _general_count_label:
@@ -361,9 +361,16 @@ func _setup_pop_list() -> void:
 
 		_pop_list_consciousness_labels.push_back(GUINode.get_gui_label_from_node(pop_row_panel.get_node(^"./pop_con")))
 
-		_pop_list_ideology_charts.push_back(GUINode.get_gui_pie_chart_from_node(pop_row_panel.get_node(^"./pop_ideology")))
+		# Row charts change with every scroll, so are drawn by a shader sharing one material rather than redrawn on the CPU.
+		var pop_ideology_chart: GUIPieChart = GUINode.get_gui_pie_chart_from_node(pop_row_panel.get_node(^"./pop_ideology"))
+		if pop_ideology_chart:
+			pop_ideology_chart.set_shader_mode(true)
+		_pop_list_ideology_charts.push_back(pop_ideology_chart)
 
-		_pop_list_issues_charts.push_back(GUINode.get_gui_pie_chart_from_node(pop_row_panel.get_node(^"./pop_issues")))
+		var pop_issues_chart: GUIPieChart = GUINode.get_gui_pie_chart_from_node(pop_row_panel.get_node(^"./pop_issues"))
+		if pop_issues_chart:
+			pop_issues_chart.set_shader_mode(true)
+		_pop_list_issues_charts.push_back(pop_issues_chart)
 
 		_pop_list_unemployment_progressbars.push_back(GUINode.get_gui_progress_bar_from_node(pop_row_panel.get_node(^"./pop_unemployment_bar")))
 
@@ -404,8 +411,8 @@ func _update_info() -> void:
 		# Province list
 		_update_province_list()
 
-		# Pop filter buttons, Distributions, Pop list
-		_update_pops()
+		# Pop filter buttons, Distributions, Pop list (updated via population_menu_pops_changed)
+		MenuSingleton.population_menu_refresh()
 
 		show()
 	else:
@@ -571,84 +578,107 @@ func _update_pop_list() -> void:
 			_pop_list_scrollbar.set_step_count(0)
 			_pop_list_scrollbar.hide()
 
-	var pop_rows = MenuSingleton.get_population_menu_pop_rows(
+	const pop_size_key: StringName = &"size"
+	const pop_type_icon_key: StringName = &"pop_type_icon"
+	const pop_culture_key: StringName = &"culture"
+	const pop_religion_icon_key: StringName = &"religion_icon"
+	const pop_location_key: StringName = &"location"
+	const pop_militancy_key: StringName = &"militancy"
+	const pop_consciousness_key: StringName = &"consciousness"
+	const pop_ideology_slice_offsets_key: StringName = &"ideology_slice_offsets"
+	const pop_ideology_slice_identifiers_key: StringName = &"ideology_slice_identifiers"
+	const pop_ideology_slice_colours_key: StringName = &"ideology_slice_colours"
+	const pop_ideology_slice_weights_key: StringName = &"ideology_slice_weights"
+	const pop_issues_slice_offsets_key: StringName = &"issues_slice_offsets"
+	const pop_issues_slice_identifiers_key: StringName = &"issues_slice_identifiers"
+	const pop_issues_slice_colours_key: StringName = &"issues_slice_colours"
+	const pop_issues_slice_weights_key: StringName = &"issues_slice_weights"
+	const pop_unemployment_key: StringName = &"unemployment"
+	const pop_cash_key: StringName = &"cash"
+	const pop_daily_money_key: StringName = &"daily_money"
+	const pop_life_needs_key: StringName = &"life_needs"
+	const pop_everyday_needs_key: StringName = &"everyday_needs"
+	const pop_luxury_needs_key: StringName = &"luxury_needs"
+	const pop_rebel_icon_key: StringName = &"rebel_icon"
+	const pop_size_change_key: StringName = &"size_change"
+	const pop_literacy_key: StringName = &"literacy"
+
+	var pop_columns: Dictionary = MenuSingleton.get_population_menu_pop_columns(
 		_pop_list_scroll_index,
 		_pop_list_rows.size(),
 	)
+	var pop_row_count: int = 0
+	if not pop_columns.is_empty():
+		pop_row_count = (pop_columns[pop_size_key] as PackedInt32Array).size()
+
+	# Pie chart slices are shared by all rows, so are looked up once and passed with each row's range of slices.
+	var ideology_slice_offsets: PackedInt32Array = pop_columns.get(pop_ideology_slice_offsets_key, PackedInt32Array())
+	var ideology_slice_identifiers: PackedStringArray = pop_columns.get(pop_ideology_slice_identifiers_key, PackedStringArray())
+	var ideology_slice_colours: PackedColorArray = pop_columns.get(pop_ideology_slice_colours_key, PackedColorArray())
+	var ideology_slice_weights: PackedFloat32Array = pop_columns.get(pop_ideology_slice_weights_key, PackedFloat32Array())
+	var issues_slice_offsets: PackedInt32Array = pop_columns.get(pop_issues_slice_offsets_key, PackedInt32Array())
+	var issues_slice_identifiers: PackedStringArray = pop_columns.get(pop_issues_slice_identifiers_key, PackedStringArray())
+	var issues_slice_colours: PackedColorArray = pop_columns.get(pop_issues_slice_colours_key, PackedColorArray())
+	var issues_slice_weights: PackedFloat32Array = pop_columns.get(pop_issues_slice_weights_key, PackedFloat32Array())
 
 	for index: int in _pop_list_rows.size():
 		if not _pop_list_rows[index]:
 			continue
-		if index < pop_rows.size():
-			const pop_size_key: StringName = &"size"
-			const pop_type_icon_key: StringName = &"pop_type_icon"
-			const pop_culture_key: StringName = &"culture"
-			const pop_religion_icon_key: StringName = &"religion_icon"
-			const pop_location_key: StringName = &"location"
-			const pop_militancy_key: StringName = &"militancy"
-			const pop_consciousness_key: StringName = &"consciousness"
-			const pop_ideology_key: StringName = &"ideology"
-			const pop_issues_key: StringName = &"issues"
-			const pop_unemployment_key: StringName = &"unemployment"
-			const pop_cash_key: StringName = &"cash"
-			const pop_daily_money_key: StringName = &"daily_money"
-			const pop_life_needs_key: StringName = &"life_needs"
-			const pop_everyday_needs_key: StringName = &"everyday_needs"
-			const pop_luxury_needs_key: StringName = &"luxury_needs"
-			const pop_rebel_icon_key: StringName = &"rebel_icon"
-			const pop_size_change_key: StringName = &"size_change"
-			const pop_literacy_key: StringName = &"literacy"
-
-			var pop_row: Dictionary = pop_rows[index]
-
+		if index < pop_row_count:
 			if _pop_list_size_labels[index]:
-				_pop_list_size_labels[index].set_text(GUINode.int_to_string_suffixed(pop_row[pop_size_key]))
+				_pop_list_size_labels[index].set_text(GUINode.int_to_string_suffixed(pop_columns[pop_size_key][index]))
 			if _pop_list_type_buttons[index]:
-				_pop_list_type_buttons[index].set_icon_index(pop_row[pop_type_icon_key])
+				_pop_list_type_buttons[index].set_icon_index(pop_columns[pop_type_icon_key][index])
 				# TODO - replace with actual poptype
-				_pop_list_type_buttons[index].set_tooltip_string("Pop Type #%d" % pop_row[pop_type_icon_key])
+				_pop_list_type_buttons[index].set_tooltip_string("Pop Type #%d" % pop_columns[pop_type_icon_key][index])
 			if _pop_list_culture_labels[index]:
-				_pop_list_culture_labels[index].set_text(pop_row[pop_culture_key])
+				_pop_list_culture_labels[index].set_text(pop_columns[pop_culture_key][index])
 				_pop_list_culture_labels[index].set_tooltip_string("NO_ASSIM_NOW")
 			if _pop_list_religion_icons[index]:
-				_pop_list_religion_icons[index].set_icon_index(pop_row[pop_religion_icon_key])
+				_pop_list_religion_icons[index].set_icon_index(pop_columns[pop_religion_icon_key][index])
 				# TODO - replace with actual religion
-				_pop_list_religion_icons[index].set_tooltip_string("Religion #%d" % pop_row[pop_religion_icon_key])
+				_pop_list_religion_icons[index].set_tooltip_string("Religion #%d" % pop_columns[pop_religion_icon_key][index])
 			if _pop_list_location_labels[index]:
-				var province_name: String = GUINode.format_province_name(pop_row.get(pop_location_key, ""))
+				var province_name: String = GUINode.format_province_name(pop_columns[pop_location_key][index])
 				_pop_list_location_labels[index].set_text(province_name)
 				_pop_list_location_labels[index].set_tooltip_string(province_name)
 			if _pop_list_militancy_labels[index]:
-				_pop_list_militancy_labels[index].set_text(GUINode.float_to_string_dp(pop_row[pop_militancy_key], 2))
+				_pop_list_militancy_labels[index].set_text(GUINode.float_to_string_dp(pop_columns[pop_militancy_key][index], 2))
 				# TODO - test tooltip, add monthly change + source breakdown
 				_pop_list_militancy_labels[index].set_tooltip_string("POP_MIL_TOTAL")
 			if _pop_list_consciousness_labels[index]:
-				_pop_list_consciousness_labels[index].set_text(GUINode.float_to_string_dp(pop_row[pop_consciousness_key], 2))
+				_pop_list_consciousness_labels[index].set_text(GUINode.float_to_string_dp(pop_columns[pop_consciousness_key][index], 2))
 				# TODO - test tooltip, add monthly change + source breakdown
 				_pop_list_consciousness_labels[index].set_tooltip_string("POP_CON_TOTAL")
 			if _pop_list_ideology_charts[index]:
-				_pop_list_ideology_charts[index].set_slices_array(pop_row[pop_ideology_key])
+				_pop_list_ideology_charts[index].set_slices_packed(
+					ideology_slice_identifiers, ideology_slice_colours, ideology_slice_weights,
+					ideology_slice_offsets[index], ideology_slice_offsets[index + 1],
+				)
 			if _pop_list_issues_charts[index]:
-				_pop_list_issues_charts[index].set_slices_array(pop_row[pop_issues_key])
+				_pop_list_issues_charts[index].set_slices_packed(
+					issues_slice_identifiers, issues_slice_colours, issues_slice_weights,
+					issues_slice_offsets[index], issues_slice_offsets[index + 1],
+				)
 			if _pop_list_unemployment_progressbars[index]:
-				var unemployment: float = pop_row[pop_unemployment_key]
+				var unemployment: float = pop_columns[pop_unemployment_key][index]
 				_pop_list_unemployment_progressbars[index].set_value_no_signal(unemployment)
 				_pop_list_unemployment_progressbars[index].set_tooltip_string("%s: §Y%s%%" % [
 					tr(&"UNEMPLOYMENT"), GUINode.float_to_string_dp(unemployment * 100.0, 3),
 				])
 			if _pop_list_cash_labels[index]:
-				_pop_list_cash_labels[index].set_text("%s¤" % GUINode.float_to_string_dp(pop_row[pop_cash_key], 2))
+				_pop_list_cash_labels[index].set_text("%s¤" % GUINode.float_to_string_dp(pop_columns[pop_cash_key][index], 2))
 				_pop_list_cash_labels[index].set_tooltip_string_and_substitution_dict("POP_DAILY_MONEY", {
-					"VAL": GUINode.float_to_string_dp(pop_row[pop_daily_money_key], 2),
+					"VAL": GUINode.float_to_string_dp(pop_columns[pop_daily_money_key][index], 2),
 				})
 			if _pop_list_life_needs_progressbars[index]:
-				var life_needs: float = pop_row[pop_life_needs_key]
+				var life_needs: float = pop_columns[pop_life_needs_key][index]
 				_pop_list_life_needs_progressbars[index].set_value_no_signal(life_needs)
 				_pop_list_life_needs_progressbars[index].set_tooltip_string_and_substitution_dict("GETTING_NEEDS", {
 					"NEED": "LIFE_NEEDS", "VAL": GUINode.float_to_string_dp(life_needs * 100.0, 1),
 				})
 			if _pop_list_everyday_needs_progressbars[index]:
-				var everyday_needs: float = pop_row[pop_everyday_needs_key]
+				var everyday_needs: float = pop_columns[pop_everyday_needs_key][index]
 				_pop_list_everyday_needs_progressbars[index].set_value_no_signal(everyday_needs)
 				_pop_list_everyday_needs_progressbars[index].set_tooltip_string_and_substitution_dict("GETTING_NEEDS", {
 					"NEED": "EVERYDAY_NEEDS", "VAL": GUINode.float_to_string_dp(
@@ -657,7 +687,7 @@ func _update_pop_list() -> void:
 					),
 				})
 			if _pop_list_luxury_needs_progressbars[index]:
-				var luxury_needs: float = pop_row[pop_luxury_needs_key]
+				var luxury_needs: float = pop_columns[pop_luxury_needs_key][index]
 				_pop_list_luxury_needs_progressbars[index].set_value_no_signal(luxury_needs)
 				_pop_list_luxury_needs_progressbars[index].set_tooltip_string_and_substitution_dict("GETTING_NEEDS", {
 					"NEED": "LUXURY_NEEDS", "VAL": GUINode.float_to_string_dp(
@@ -666,7 +696,7 @@ func _update_pop_list() -> void:
 					),
 				})
 			if _pop_list_rebel_icons[index]:
-				var rebel_icon: int = pop_row.get(pop_rebel_icon_key, 0)
+				var rebel_icon: int = pop_columns[pop_rebel_icon_key][index]
 				if rebel_icon > 0:
 					_pop_list_rebel_icons[index].set_icon_index(rebel_icon)
 					_pop_list_rebel_icons[index].show()
@@ -682,15 +712,15 @@ func _update_pop_list() -> void:
 				_pop_list_national_movement_flags[index].hide()
 
 			if _pop_list_size_change_icons[index]:
-				var pop_change: int = pop_row[pop_size_change_key]
+				var pop_change: int = pop_columns[pop_size_change_key][index]
 				_pop_list_size_change_icons[index].set_icon_index(get_growth_icon_index(pop_change))
 				_pop_list_size_change_icons[index].set_tooltip_string("%s §%s%s" % [
 					tr(&"POPULATION_CHANGED_BY"), "G+" if pop_change > 0 else "Y+" if pop_change == 0 else "R", str(pop_change),
 				])
 			if _pop_list_literacy_labels[index]:
-				_pop_list_literacy_labels[index].set_text("%s%%" % GUINode.float_to_string_dp(pop_row[pop_literacy_key] * 100, 2))
+				_pop_list_literacy_labels[index].set_text("%s%%" % GUINode.float_to_string_dp(pop_columns[pop_literacy_key][index] * 100, 2))
 				_pop_list_literacy_labels[index].set_tooltip_string("%s: §G%s%%" % [
-					tr(&"LIT_CHANGE"), GUINode.float_to_string_dp(pop_row[pop_literacy_key] / 64.0, 2),
+					tr(&"LIT_CHANGE"), GUINode.float_to_string_dp(pop_columns[pop_literacy_key][index] / 64.0, 2),
 				])
 
 			_pop_list_rows[index].show()
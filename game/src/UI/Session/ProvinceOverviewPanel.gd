@@ -90,6 +90,9 @@ func _ready() -> void:
 	_terrain_type_icon = get_gui_icon_from_nodepath(^"./province_view/province_view_header/prov_terrain")
 	_life_rating_bar = get_gui_progress_bar_from_nodepath(^"./province_view/province_view_header/liferating")
 	_controller_flag = get_gui_masked_flag_from_nodepath(^"./province_view/province_view_header/controller_flag")
+	if _controller_flag:
+		# Changes with every selected province, so is composited by a shader rather than regenerating the flag image.
+		_controller_flag.set_shader_mode(true)
 
 	# Statistics
 	_rgo_icon = get_gui_icon_from_nodepath(^"./province_view/province_statistics/goods_type")
@@ -191,10 +194,10 @@ func _update_info() -> void:
 	const _province_info_controller_key: StringName = &"controller"
 	const _province_info_controller_tooltip_key: StringName = &"controller_tooltip"
 	const _province_info_rgo_icon_key: StringName = &"rgo_icon"
-	const _province_info_rgo_production_tooltip_key: StringName = &"rgo_production_tooltip"
+	const _province_info_rgo_production_tooltip_id_key: StringName = &"rgo_production_tooltip_id"
 	const _province_info_rgo_total_employees_key: StringName = &"rgo_total_employees"
 	const _province_info_rgo_employment_percentage_key: StringName = &"rgo_employment_percentage"
-	const _province_info_rgo_employment_tooltip_key: StringName = &"rgo_employment_tooltip"
+	const _province_info_rgo_employment_tooltip_id_key: StringName = &"rgo_employment_tooltip_id"
 	const _province_info_rgo_output_quantity_yesterday_key: StringName = &"rgo_output_quantity_yesterday"
 	const _province_info_rgo_revenue_yesterday_key: StringName = &"rgo_revenue_yesterday"
 	const _province_info_crime_name_key: StringName = &"crime_name"
@@ -263,49 +266,49 @@ func _update_info() -> void:
 			_controller_flag.set_tooltip_string(_province_info.get(_province_info_controller_tooltip_key, ""))
 
 		# Statistics
-		var rgo_production_tooltip: String = _province_info.get(
-			_province_info_rgo_production_tooltip_key,
-			"",
+		var rgo_production_tooltip_id: int = _province_info.get(
+			_province_info_rgo_production_tooltip_id_key,
+			0,
 		)
 
 		if _rgo_icon:
 			_rgo_icon.set_icon_index(_province_info.get(_province_info_rgo_icon_key, -1) + 2)
-			_rgo_icon.set_tooltip_string(rgo_production_tooltip)
+			_rgo_icon.set_tooltip_id(rgo_production_tooltip_id)
 
 		if _rgo_produced_label:
 			_rgo_produced_label.text = GUINode.float_to_string_dp(
 				_province_info.get(_province_info_rgo_output_quantity_yesterday_key, 0),
 				3,
 			)
-			_rgo_produced_label.set_tooltip_string(rgo_production_tooltip)
+			_rgo_produced_label.set_tooltip_id(rgo_production_tooltip_id)
 
 		if _rgo_income_label:
 			_rgo_income_label.text = "%s¤" % GUINode.float_to_string_dp(
 				_province_info.get(_province_info_rgo_revenue_yesterday_key, 0),
 				3,
 			)
-			_rgo_income_label.set_tooltip_string(rgo_production_tooltip)
+			_rgo_income_label.set_tooltip_id(rgo_production_tooltip_id)
 
 		var rgo_employment_percentage: int = _province_info.get(
 			_province_info_rgo_employment_percentage_key,
 			0,
 		)
-		var rgo_employment_tooltip: String = _province_info.get(
-			_province_info_rgo_employment_tooltip_key,
-			"",
+		var rgo_employment_tooltip_id: int = _province_info.get(
+			_province_info_rgo_employment_tooltip_id_key,
+			0,
 		)
 
 		if _rgo_employment_percentage_icon:
 			_rgo_employment_percentage_icon.set_icon_index(rgo_employment_percentage / 10 + 1)
-			_rgo_employment_percentage_icon.set_tooltip_string(rgo_employment_tooltip)
+			_rgo_employment_percentage_icon.set_tooltip_id(rgo_employment_tooltip_id)
 
 		if _rgo_employment_population_label:
 			_rgo_employment_population_label.text = GUINode.int_to_string_suffixed(_province_info.get(_province_info_rgo_total_employees_key, 0))
-			_rgo_employment_population_label.set_tooltip_string(rgo_employment_tooltip)
+			_rgo_employment_population_label.set_tooltip_id(rgo_employment_tooltip_id)
 
 		if _rgo_employment_percentage_label:
 			_rgo_employment_percentage_label.text = "%d%%" % rgo_employment_percentage
-			_rgo_employment_percentage_label.set_tooltip_string(rgo_employment_tooltip)
+			_rgo_employment_percentage_label.set_tooltip_id(rgo_employment_tooltip_id)
 
 		if _crime_name_label:
 			_crime_name_label.text = _province_info.get(_province_info_crime_name_key, "")
@@ -298,7 +298,7 @@ func _update_info() -> void:
 	const literacy_key: StringName = &"literacy"
 	const literacy_change_key: StringName = &"literacy_change"
 	const research_points_key: StringName = &"research_points"
-	const research_points_tooltip_key: StringName = &"research_points_tooltip"
+	const research_points_tooltip_id_key: StringName = &"research_points_tooltip_id"
 
 	if _technology_progress_bar:
 		_technology_progress_bar.set_value(topbar_info.get(research_progress_key, 0))
@@ -318,7 +318,7 @@ func _update_info() -> void:
 
 	if _technology_research_points_label:
 		_technology_research_points_label.set_text("§Y%s" % GUINode.float_to_string_dp(topbar_info.get(research_points_key, 0), 2))
-		_technology_research_points_label.set_tooltip_string(topbar_info.get(research_points_tooltip_key, ""))
+		_technology_research_points_label.set_tooltip_id(topbar_info.get(research_points_tooltip_id_key, 0))
 
 	## Politics
 	if _politics_party_icon:
@@ -418,25 +418,27 @@ func _update_info() -> void:
 
 	const is_mobilised_key: StringName = &"is_mobilised"
 	const mobilisation_regiments_key: StringName = &"mobilisation_regiments"
-	const mobilisation_impact_tooltip_key: StringName = &"mobilisation_impact_tooltip"
+	const mobilisation_impact_tooltip_id_key: StringName = &"mobilisation_impact_tooltip_id"
 
 	if _military_mobilisation_size_label:
 		if topbar_info.get(is_mobilised_key, false):
 			_military_mobilisation_size_label.set_text("§R-")
+			_military_mobilisation_size_label.set_tooltip_id(0)
 			_military_mobilisation_size_label.set_tooltip_string("TOPBAR_MOBILIZED")
 		else:
 			var mobilisation_regiments: String = str(topbar_info.get(mobilisation_regiments_key, 0))
 			_military_mobilisation_size_label.set_text("§Y%s" % mobilisation_regiments)
 			_military_mobilisation_size_label.set_tooltip_string(
-				tr(&"TOPBAR_MOBILIZE_TOOLTIP").replace("$CURR$", mobilisation_regiments) + "\n\n" + topbar_info.get(mobilisation_impact_tooltip_key, "")
+				tr(&"TOPBAR_MOBILIZE_TOOLTIP").replace("$CURR$", mobilisation_regiments) + "\n\n" + MenuSingleton.get_provided_tooltip_placeholder()
 			)
+			_military_mobilisation_size_label.set_tooltip_id(topbar_info.get(mobilisation_impact_tooltip_id_key, 0))
 
 	const leadership_key: StringName = &"leadership"
-	const leadership_tooltip_key: StringName = &"leadership_tooltip"
+	const leadership_tooltip_id_key: StringName = &"leadership_tooltip_id"
 
 	if _military_leadership_points_label:
 		_military_leadership_points_label.set_text("§Y%d" % topbar_info.get(leadership_key, 0))
-		_military_leadership_points_label.set_tooltip_string(topbar_info.get(leadership_tooltip_key, ""))
+		_military_leadership_points_label.set_tooltip_id(topbar_info.get(leadership_tooltip_id_key, 0))
 
 
 func _update_speed_controls() -> void:
@@ -242,7 +242,6 @@ func _update_info() -> void:
 
 		_update_trade_details()
 
-		const good_producers_tooltips_key: StringName = &"good_producers_tooltips"
 		const good_trading_yesterday_tooltips_key: StringName = &"good_trading_yesterday_tooltips"
 		const government_needs_key: StringName = &"government_needs"
 		const factory_needs_key: StringName = &"factory_needs"
@@ -253,10 +252,8 @@ func _update_info() -> void:
 
 		var trade_info: Dictionary = MenuSingleton.get_trade_menu_tables_info()
 
-		var good_producers_tooltips: PackedStringArray = trade_info.get(
-			good_producers_tooltips_key,
-			[] as PackedStringArray,
-		)
+		# Tables without their own good tooltips fall back to each good's top producers tooltip
+		var good_producers_tooltips: PackedStringArray = []
 
 		_generate_listbox(
 			Table.GOVERNMENT_NEEDS,
@@ -289,7 +286,7 @@ func _update_info() -> void:
 			good_producers_tooltips,
 		)
 
-		_generate_good_entries(good_producers_tooltips)
+		_generate_good_entries()
 
 		show()
 	else:
@@ -488,6 +485,7 @@ func _float_to_string_suffixed_dp_dynamic(value: float) -> String:
 
 
 # data is either a PackedVector2Array, PackedVector3Array or PackedVector4Array
+# good_tooltips are looked up by good index, if empty each good's top producers tooltip is used instead
 
 
 func _generate_listbox(table: Table, data: Variant, good_tooltips: PackedStringArray) -> void:
@@ -515,6 +513,9 @@ func _generate_listbox(table: Table, data: Variant, good_tooltips: PackedStringA
 		var entry_data: Variant = data[index]
 		var good_index: int = int(entry_data.x)
 		var good_tooltip: String = good_tooltips[good_index] if good_index < good_tooltips.size() else ""
+		var good_tooltip_id: int = MenuSingleton.make_tooltip_id(
+			MenuSingleton.TOOLTIP_GOOD_TOP_PRODUCERS, good_index
+		) if good_tooltips.is_empty() else 0
 
 		var good_button: GUIIconButton = GUINode.get_gui_icon_button_from_node_and_path(
 			entry,
@@ -523,6 +524,7 @@ func _generate_listbox(table: Table, data: Variant, good_tooltips: PackedStringA
 		if good_button:
 			good_button.set_icon_index(good_index + 2)
 			good_button.set_tooltip_string(good_tooltip)
+			good_button.set_tooltip_id(good_tooltip_id)
 			good_button.pressed.connect(
 				func() -> void:
 					_update_trade_details(entry.get_meta(TABLE_COLUMN_KEYS[0]))
@@ -576,7 +578,7 @@ func _generate_listbox(table: Table, data: Variant, good_tooltips: PackedStringA
 	_sort_table(table)
 
 
-func _generate_good_entries(good_tooltips: PackedStringArray) -> void:
+func _generate_good_entries() -> void:
 	var good_categories_info: Dictionary = MenuSingleton.get_trade_menu_good_categories_info()
 
 	for good_category: String in good_categories_info:
@@ -647,7 +649,7 @@ func _generate_good_entries(good_tooltips: PackedStringArray) -> void:
 			)
 			if good_button:
 				good_button.set_icon_index(good_index + 2)
-				good_button.set_tooltip_string(good_tooltips[good_index] if good_index < good_tooltips.size() else "")
+				good_button.set_tooltip_id(MenuSingleton.make_tooltip_id(MenuSingleton.TOOLTIP_GOOD_TOP_PRODUCERS, good_index))
 				good_button.pressed.connect(func() -> void: print("Good button pressed with index ", good_index))
 
 			var price_label: GUILabel = get_gui_label_from_node_and_path(